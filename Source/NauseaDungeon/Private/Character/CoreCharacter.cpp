@@ -115,11 +115,22 @@ bool ACoreCharacter::ReplicateSubobjects(class UActorChannel* Channel, class FOu
 			continue;
 		}
 
+		//Nothing on this component or its subobjects was marked dirty since it was last replicated to this channel.
+		if (ReplicatedObjectInterface && !ReplicatedObjectInterface->ShouldReplicateForChannel(Channel))
+		{
+			continue;
+		}
+
 		//Prep bNetInitial in RepFlags for this object (adds support for objects added after owner's initial bunch to still use InitialOnly rep condition for its variables).
 		RepFlags->bNetInitial = Channel->ReplicationMap.Find(Component) == nullptr;
 
 		bWroteSomething = Component->ReplicateSubobjects(Channel, Bunch, RepFlags) || bWroteSomething;
 		bWroteSomething = Channel->ReplicateSubobject(Component, *Bunch, *RepFlags) || bWroteSomething;
+
+		if (ReplicatedObjectInterface)
+		{
+			ReplicatedObjectInterface->NotifyReplicatedForChannel(Channel);
+		}
 	}
 
 	RepFlags->bNetInitial = bCachedNetInitial;
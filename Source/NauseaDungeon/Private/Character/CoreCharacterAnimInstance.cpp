@@ -1,6 +1,8 @@
 // Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
 
 #include "Character/CoreCharacterAnimInstance.h"
+#include "NauseaDungeon.h"
+#include "NauseaGlobalDefines.h"
 #include "Character/CoreCharacter.h"
 #include "Character/CoreCharacterMovementComponent.h"
 #include "Gameplay/StatusComponent.h"
@@ -18,9 +20,10 @@ void FCoreCharacterAnimInstanceProxy::PreUpdate(UAnimInstance* InAnimInstance, f
 {
 	if (UCoreCharacterAnimInstance* CoreAnimInstance = Cast<UCoreCharacterAnimInstance>(InAnimInstance))
 	{
-		CoreAnimInstance->SetLocomotionAnimation(CoreAnimInstance->GetLocomotionAnimation());
+		//Only read from game thread objects here. Everything the anim graph needs per frame should be copied onto the proxy.
+		LocomotionAnimations = CoreAnimInstance->GetLocomotionAnimation();
 
-		if (ACoreCharacter* CoreCharacter = CoreAnimInstance->GetCharacter())
+		if (const ACoreCharacter* CoreCharacter = CoreAnimInstance->OwningCoreCharacter)
 		{
 			const FVector& Velocity = CoreCharacter->GetVelocity();
 
@@ -45,11 +48,112 @@ void FCoreCharacterAnimInstanceProxy::PreUpdate(UAnimInstance* InAnimInstance, f
 		{
 			bIsLowLOD = false;
 		}
+
+		if (const AActor* OwningActor = CoreAnimInstance->GetOwningActor())
+		{
+			ActorForwardVector = OwningActor->GetActorForwardVector();
+			ActorRightVector = OwningActor->GetActorRightVector();
+		}
+
+		WorldTimeSeconds = CoreAnimInstance->GetWorld() ? CoreAnimInstance->GetWorld()->GetTimeSeconds() : 0.f;
+
+		PendingHitReactionList = CoreAnimInstance->PendingHitReactionList;
+		CoreAnimInstance->PendingHitReactionList.Reset();
+		PendingStatusMontageList = CoreAnimInstance->PendingStatusMontageList;
+		CoreAnimInstance->PendingStatusMontageList.Reset();
+
+		StatusMontageLoopList.Reset();
+		StatusMontageLoopList.Append(CoreAnimInstance->StatusMontageLoopList);
 	}
 
 	Super::PreUpdate(InAnimInstance, DeltaSeconds);
 }
 
+void FCoreCharacterAnimInstanceProxy::Update(float DeltaSeconds)
+{
+	Super::Update(DeltaSeconds);
+
+	for (FPendingHitReaction& HitReaction : PendingHitReactionList)
+	{
+		HitReaction.Direction = GetHitReactionDirection(HitReaction.HitDirection, ActorForwardVector, ActorRightVector);
+	}
+
+	for (FPendingStatusMontage& StatusMontage : PendingStatusMontageList)
+	{
+		StatusMontage.Direction = StatusMontage.InstigationDirection != FAISystem::InvalidDirection ?
+			GetHitReactionDirection(StatusMontage.InstigationDirection, ActorForwardVector, ActorRightVector) : EHitReactionDirection::Front;
+	}
+
+	LoopEndMontageList.Reset();
+	for (const FStatusMontageLoop& StatusMontageLoop : StatusMontageLoopList)
+	{
+		if (StatusMontageLoop.LoopEndWorldTime != -1.f && StatusMontageLoop.LoopEndWorldTime <= WorldTimeSeconds)
+		{
+			LoopEndMontageList.Add(StatusMontageLoop.Montage);
+		}
+	}
+}
+
+void FCoreCharacterAnimInstanceProxy::PostUpdate(UAnimInstance* InAnimInstance) const
+{
+	Super::PostUpdate(InAnimInstance);
+
+	UCoreCharacterAnimInstance* CoreAnimInstance = Cast<UCoreCharacterAnimInstance>(InAnimInstance);
+
+	if (!CoreAnimInstance)
+	{
+		return;
+	}
+
+	const UAnimationObject* AnimObject = CoreAnimInstance->GetCharacterAnimationObject();
+
+	if (!AnimObject)
+	{
+		return;
+	}
+
+	for (const FPendingHitReaction& HitReaction : PendingHitReactionList)
+	{
+		AnimObject->PlayHitReactionMontage(CoreAnimInstance, HitReaction.Strength, HitReaction.Direction, HitReaction.Random);
+	}
+
+	for (const FPendingStatusMontage& StatusMontage : PendingStatusMontageList)
+	{
+		if (!StatusMontage.StatusEffect.IsValid())
+		{
+			continue;
+		}
+
+		AnimObject->PlayStatusStartMontage(StatusMontage.StatusEffect.Get(), CoreAnimInstance, StatusMontage.BeginType, StatusMontage.Direction);
+	}
+
+	for (UAnimMontage* Montage : LoopEndMontageList)
+	{
+		//A status refresh processed above may have pushed this loop's end back (or revoked it).
+		const FStatusMontageLoop* StatusMontageLoop = CoreAnimInstance->StatusMontageLoopList.FindByPredicate([Montage](const FStatusMontageLoop& Entry) { return Entry.Montage == Montage; });
+
+		if (!StatusMontageLoop || StatusMontageLoop->LoopEndWorldTime == -1.f || StatusMontageLoop->LoopEndWorldTime > WorldTimeSeconds)
+		{
+			continue;
+		}
+
+		CoreAnimInstance->PlayStatusMontageLoopEnd(Montage);
+	}
+}
+
+EHitReactionDirection FCoreCharacterAnimInstanceProxy::GetHitReactionDirection(const FVector& Direction, const FVector& Forward, const FVector& Right)
+{
+	const float FrontDot = FVector::DotProduct(Direction, Forward);
+	const float RightDot = FVector::DotProduct(Direction, Right);
+
+	if (FMath::Abs(FrontDot) >= FMath::Abs(RightDot))
+	{
+		return FrontDot < 0.f ? EHitReactionDirection::Front : EHitReactionDirection::Back;
+	}
+
+	return RightDot < 0.f ? EHitReactionDirection::Right : EHitReactionDirection::Left;
+}
+
 UCoreCharacterAnimInstance::UCoreCharacterAnimInstance(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -89,21 +193,6 @@ void UCoreCharacterAnimInstance::DestroyAnimInstanceProxy(FAnimInstanceProxy* In
 
 }
 
-void UCoreCharacterAnimInstance::BeginDestroy()
-{
-	if (GetWorld())
-	{
-		FTimerManager& TimerManager = GetWorld()->GetTimerManager();
-
-		for (TPair<UAnimMontage*, FTimerHandle>& Entry : StatusMontageLoopTimerMap)
-		{
-			TimerManager.ClearTimer(Entry.Value);
-		}
-	}
-
-	Super::BeginDestroy();
-}
-
 const UAnimationObject* UCoreCharacterAnimInstance::GetCharacterAnimationObject() const
 {
 	if (!GetCharacter())
@@ -121,33 +210,42 @@ const UAnimationObject* UCoreCharacterAnimInstance::GetCharacterAnimationObject(
 	}
 }
 
-bool UCoreCharacterAnimInstance::DoesMontageHaveRegisteredLoopTimerHandle(UAnimMontage* Montage) const
+bool UCoreCharacterAnimInstance::DoesMontageHaveRegisteredLoop(UAnimMontage* Montage) const
+{
+	return StatusMontageLoopList.ContainsByPredicate([Montage](const FStatusMontageLoop& Entry) { return Entry.Montage == Montage; });
+}
+
+void UCoreCharacterAnimInstance::RegisterMontageLoop(UAnimMontage* Montage, float LoopEndWorldTime)
 {
-	return StatusMontageLoopTimerMap.Contains(Montage);
+	ensure(!DoesMontageHaveRegisteredLoop(Montage));
+	StatusMontageLoopList.Emplace(Montage, LoopEndWorldTime);
 }
 
-void UCoreCharacterAnimInstance::RegisterMontageLoopTimerHandle(UAnimMontage* Montage, FTimerHandle Handle)
+void UCoreCharacterAnimInstance::RevokeMontageLoop(UAnimMontage* Montage)
 {
-	ensure(!StatusMontageLoopTimerMap.Contains(Montage));
-	StatusMontageLoopTimerMap.Add(Montage) = Handle;
+	StatusMontageLoopList.RemoveAllSwap([Montage](const FStatusMontageLoop& Entry) { return Entry.Montage == Montage; }, false);
 }
 
-void UCoreCharacterAnimInstance::RevokeMontageLoopTimerHandle(UAnimMontage* Montage)
+void UCoreCharacterAnimInstance::PlayStatusMontageLoopEnd(UAnimMontage* Montage)
 {
-	if (!StatusMontageLoopTimerMap.Contains(Montage))
+	if (!Montage)
 	{
 		return;
 	}
 
-	GetWorld()->GetTimerManager().ClearTimer(StatusMontageLoopTimerMap[Montage]);
-	StatusMontageLoopTimerMap.Remove(Montage);
+	Montage_Stop(0.25f, Montage);
+	Montage_Play(Montage, 1.f, EMontagePlayReturnType::MontageLength, 0.f, false);
+	Montage_JumpToSection(UAnimationObject::StatusLoopEndSection, Montage);
+	RevokeMontageLoop(Montage);
 }
 
 void UCoreCharacterAnimInstance::NativeInitializeAnimation()
 {
 	Super::NativeInitializeAnimation();
 
-	if (ACoreCharacter* CoreCharacter = Cast<ACoreCharacter>(GetOwningActor()))
+	OwningCoreCharacter = Cast<ACoreCharacter>(GetOwningActor());
+
+	if (ACoreCharacter* CoreCharacter = OwningCoreCharacter)
 	{
 		SetCoreCharacterMovementComponent(CoreCharacter->GetCoreMovementComponent());
 
@@ -167,76 +265,69 @@ void UCoreCharacterAnimInstance::NativeInitializeAnimation()
 	{
 		DefaultLocomationAnimations = LocomotionCDO->LocomontionAnimations;
 	}
-}
 
-void UCoreCharacterAnimInstance::OnReceiveHitEvent(const UStatusComponent* StatusComponent, const FHitEvent& HitEvent)
-{
-	const UAnimationObject* AnimObject = GetCharacterAnimationObject();
-	if (!AnimObject)
+	SetLocomotionAnimation(GetLocomotionAnimation());
+
+#if !UE_BUILD_SHIPPING
+	//Event graph updates run on the game thread every frame and stop anim updates from being fully parallel. All per-frame state is available on CoreCharacterProxy.
+	static TSet<FName> WarnedClassSet;
+	if (IS_K2_FUNCTION_IMPLEMENTED(this, BlueprintUpdateAnimation) && !WarnedClassSet.Contains(GetClass()->GetFName()))
 	{
-		return;
+		WarnedClassSet.Add(GetClass()->GetFName());
+		UE_LOG(LogNauseaDungeon, Warning, TEXT("%s implements Blueprint Update Animation. Per-frame animation state should be read from CoreCharacterProxy instead."), *GetClass()->GetName());
 	}
+#endif
+}
 
+void UCoreCharacterAnimInstance::OnReceiveHitEvent(const UStatusComponent* StatusComponent, const FHitEvent& HitEvent)
+{
 	const UCoreDamageType* CoreDamageType = HitEvent.DamageType.GetDefaultObject();
 
-	if (!CoreDamageType)
+	if (!CoreDamageType || !GetCharacterAnimationObject())
 	{
 		return;
 	}
 
-	const float FrontDot = (FVector::DotProduct(HitEvent.HitDirection, GetCharacter()->GetActorForwardVector()));
-	const float RightDot = (FVector::DotProduct(HitEvent.HitDirection, GetCharacter()->GetActorRightVector()));
-
-	const bool bFrontHit = FrontDot < 0.f;
-	const bool bRightHit = RightDot < 0.f;
-
-	EHitReactionDirection Direction = EHitReactionDirection::Front;
-	if (FMath::Abs(FrontDot) >= FMath::Abs(RightDot))
-	{
-		Direction = bFrontHit ? EHitReactionDirection::Front : EHitReactionDirection::Back;
-	}
-	else
+	//If nothing has consumed the pending list (no animation updates while not rendered) drop the oldest hit reaction.
+	if (PendingHitReactionList.Num() >= MAX_PENDING_HIT_REACTIONS)
 	{
-		Direction = bRightHit ? EHitReactionDirection::Right : EHitReactionDirection::Left;
+		PendingHitReactionList.RemoveAt(0, 1, false);
 	}
 
-	AnimObject->PlayHitReactionMontage(this, CoreDamageType->GetHitReactionStrength(HitEvent), Direction, HitEvent.Random);
+	FPendingHitReaction& HitReaction = PendingHitReactionList.AddDefaulted_GetRef();
+	HitReaction.Strength = CoreDamageType->GetHitReactionStrength(HitEvent);
+	HitReaction.HitDirection = HitEvent.HitDirection;
+	HitReaction.Random = HitEvent.Random;
 }
 
 void UCoreCharacterAnimInstance::OnStatusEffectStart(UStatusComponent* StatusComponent, UStatusEffectBase* StatusEffect, EStatusBeginType BeginType)
 {
-	const UAnimationObject* AnimObject = GetCharacterAnimationObject();
-	if (!AnimObject)
+	if (!StatusEffect || !GetCharacterAnimationObject())
 	{
 		return;
 	}
 
-	const FVector_NetQuantizeNormal& InstigationDirection = StatusEffect->GetInstigationDirection();
-	EHitReactionDirection Direction = EHitReactionDirection::Front;
+	FPendingStatusMontage* PendingStatusMontage = PendingStatusMontageList.FindByPredicate([StatusEffect](const FPendingStatusMontage& Entry) { return Entry.StatusEffect == StatusEffect; });
 
-	if (InstigationDirection != FAISystem::InvalidDirection)
+	if (!PendingStatusMontage)
 	{
-		const float FrontDot = (FVector::DotProduct(InstigationDirection, GetCharacter()->GetActorForwardVector()));
-		const float RightDot = (FVector::DotProduct(InstigationDirection, GetCharacter()->GetActorRightVector()));
-
-		const bool bFrontHit = FrontDot < 0.f;
-		const bool bRightHit = RightDot < 0.f;
-
-		if (FMath::Abs(FrontDot) >= FMath::Abs(RightDot))
-		{
-			Direction = bFrontHit ? EHitReactionDirection::Front : EHitReactionDirection::Back;
-		}
-		else
-		{
-			Direction = bRightHit ? EHitReactionDirection::Right : EHitReactionDirection::Left;
-		}
+		PendingStatusMontage = &PendingStatusMontageList.AddDefaulted_GetRef();
+		PendingStatusMontage->StatusEffect = StatusEffect;
+		PendingStatusMontage->BeginType = BeginType;
+	}
+	else if (BeginType == EStatusBeginType::Initial)
+	{
+		PendingStatusMontage->BeginType = BeginType;
 	}
 
-	AnimObject->PlayStatusStartMontage(StatusEffect, this, BeginType, Direction);
+	PendingStatusMontage->InstigationDirection = StatusEffect->GetInstigationDirection();
 }
 
 void UCoreCharacterAnimInstance::OnStatusEffectEnd(UStatusComponent* StatusComponent, UStatusEffectBase* StatusEffect, EStatusEndType EndType)
 {
+	//If this effect ended before its start was ever played, there's nothing to play.
+	PendingStatusMontageList.RemoveAllSwap([StatusEffect](const FPendingStatusMontage& Entry) { return Entry.StatusEffect == StatusEffect; }, false);
+
 	const UAnimationObject* AnimObject = GetCharacterAnimationObject();
 	if (!AnimObject)
 	{
@@ -126,13 +126,13 @@ bool UAnimationObject::PlayStatusStartMontage(UStatusEffectBase* StatusEffect, U
 		return false;
 	}
 
-	if (!AnimInstance->DoesMontageHaveRegisteredLoopTimerHandle(StatusMontage) || BeginType == EStatusBeginType::Initial || bRestartOnRefresh)
+	if (!AnimInstance->DoesMontageHaveRegisteredLoop(StatusMontage) || BeginType == EStatusBeginType::Initial || bRestartOnRefresh)
 	{
 		AnimInstance->Montage_Stop(0.2f, StatusMontage);
 		AnimInstance->Montage_Play(StatusMontage, 1.f, EMontagePlayReturnType::MontageLength, 0.f, false);
 	}
 
-	AnimInstance->RevokeMontageLoopTimerHandle(StatusMontage);
+	AnimInstance->RevokeMontageLoop(StatusMontage);
 	FName SectionName = NAME_None;
 	switch (Direction)
 	{
@@ -161,28 +161,12 @@ bool UAnimationObject::PlayStatusStartMontage(UStatusEffectBase* StatusEffect, U
 	{
 		if (!bRestartOnRefresh)
 		{
-			const float StatusTimeRemaining = StatusEffect->GetStatusTimeRemaining();
-			FTimerHandle LoopEndHandle;
-			StatusEffect->GetWorld()->GetTimerManager().SetTimer(LoopEndHandle, StatusTimeRemaining, false);
-			AnimInstance->RegisterMontageLoopTimerHandle(StatusMontage, LoopEndHandle);
+			AnimInstance->RegisterMontageLoop(StatusMontage, -1.f);
 		}
 
 		return true;
 	}
 
-	auto PlayMontageEnd = [](TWeakObjectPtr<UStatusEffectBase> StatusEffect, TWeakObjectPtr<UAnimMontage> AnimMontage, TWeakObjectPtr<UCoreCharacterAnimInstance> AnimInstance)
-	{
-		if (!StatusEffect.IsValid() || !AnimInstance.IsValid() || !AnimMontage.IsValid())
-		{
-			return;
-		}
-
-		AnimInstance->Montage_Stop(0.25f, AnimMontage.Get());
-		AnimInstance->Montage_Play(AnimMontage.Get(), 1.f, EMontagePlayReturnType::MontageLength, 0.f, false);
-		AnimInstance->Montage_JumpToSection(StatusLoopEndSection, AnimMontage.Get());
-		AnimInstance->RevokeMontageLoopTimerHandle(AnimMontage.Get());
-	};
-
 	const float StatusTimeRemaining = StatusEffect->GetStatusTimeRemaining();
 
 	//If we have no idea when this montage ends assume it's being manually controlled elsewhere.
@@ -196,16 +180,12 @@ bool UAnimationObject::PlayStatusStartMontage(UStatusEffectBase* StatusEffect, U
 	//If this effect is already about to end then start montage end immediately.
 	if (TimeUntilStartLoopEnd <= 0.f)
 	{
-		PlayMontageEnd(StatusEffect, StatusMontage, AnimInstance);
+		AnimInstance->PlayStatusMontageLoopEnd(StatusMontage);
 		return true;
 	}
 
-	FTimerHandle LoopEndHandle;
-	StatusEffect->GetWorld()->GetTimerManager().SetTimer(LoopEndHandle,
-		FTimerDelegate::CreateWeakLambda(StatusEffect->GetTypedOuter<AActor>(), PlayMontageEnd, TWeakObjectPtr<UStatusEffectBase>(StatusEffect), TWeakObjectPtr<UAnimMontage>(StatusMontage), TWeakObjectPtr<UCoreCharacterAnimInstance>(AnimInstance)),
-		TimeUntilStartLoopEnd, false);
-	
-	AnimInstance->RegisterMontageLoopTimerHandle(StatusMontage, LoopEndHandle);
+	//Loop end is picked up by FCoreCharacterAnimInstanceProxy during the animation update once this time is reached.
+	AnimInstance->RegisterMontageLoop(StatusMontage, AnimInstance->GetWorld()->GetTimeSeconds() + TimeUntilStartLoopEnd);
 	return true;
 }
 
@@ -228,7 +208,7 @@ bool UAnimationObject::PlayStatusEndMontage(UStatusEffectBase* StatusEffect, UCo
 		return false;
 	}
 
-	AnimInstance->RevokeMontageLoopTimerHandle(StatusMontage);
+	AnimInstance->RevokeMontageLoop(StatusMontage);
 	AnimInstance->Montage_Stop(StatusEffectAnimations.StatusMap[StatusEffect->GetStatusType()].StopBlendTime, StatusMontage);
 
 	return true;
@@ -8,6 +8,7 @@
 #include "GameFramework/PlayerController.h"
 #include "Overlord/DungeonGameState.h"
 #include "Character/DungeonCharacterMovementComponent.h"
+#include "Gameplay/StatusComponent.h"
 
 #if WITH_EDITORONLY_DATA
 #include "Components/ArrowComponent.h"
@@ -60,11 +61,7 @@ ADungeonCharacter::ADungeonCharacter(const FObjectInitializer& ObjectInitializer
 				FVector Location;
 				FRotator Rotator;
 				World->GetFirstPlayerController()->GetPlayerViewPoint(Location, Rotator);
-				
-				FBoxSphereBounds Bounds = Component->GetCachedLocalBounds();
-				const float ComponentBoundSize = Bounds.SphereRadius;
-				const FVector ComponentWorldLocation = Owner->GetActorTransform().TransformPosition(Bounds.Origin);
-				return (FMath::Square(Bounds.SphereRadius) / FMath::Max(1.f, FVector::DistSquared(Location, ComponentWorldLocation))) * 100.f;
+				return ADungeonCharacter::CalculateSignificance(Owner, Component->GetCachedLocalBounds(), Location);
 			});
 
 		}
@@ -74,6 +71,10 @@ ADungeonCharacter::ADungeonCharacter(const FObjectInitializer& ObjectInitializer
 			SkeletalMeshComponent->SetAutoCalculateSignificance(true);
 		}
 	}
+
+	NetLODList.Add(FDungeonCharacterNetLOD(0.1f, 1.f, false));
+	NetLODList.Add(FDungeonCharacterNetLOD(0.01f, 0.5f, true));
+	NetLODList.Add(FDungeonCharacterNetLOD(0.f, 0.2f, true));
 }
 
 void ADungeonCharacter::BeginPlay()
@@ -83,9 +84,22 @@ void ADungeonCharacter::BeginPlay()
 	if (GetLocalRole() == ROLE_Authority)
 	{
 		SpawnLocation = GetActorLocation();
+
+		if (!IsNetMode(NM_Standalone) && NetLODList.Num() > 1)
+		{
+			//Stagger updates so that a wave spawned on the same frame does not evaluate on the same frame.
+			GetWorldTimerManager().SetTimer(NetLODTimerHandle, this, &ADungeonCharacter::UpdateNetLOD, NetLODUpdateInterval, true, FMath::FRand() * NetLODUpdateInterval);
+		}
 	}
 }
 
+void ADungeonCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	GetWorldTimerManager().ClearTimer(NetLODTimerHandle);
+}
+
 void ADungeonCharacter::PreRegisterAllComponents()
 {
 	Super::PreRegisterAllComponents();
@@ -189,6 +203,79 @@ void ADungeonCharacter::NotifyCharacterUnableToPath()
 	TeleportTo(SpawnLocation, GetActorRotation());
 }
 
+float ADungeonCharacter::CalculateSignificance(const AActor* Owner, const FBoxSphereBounds& LocalBounds, const FVector& ViewLocation)
+{
+	const FVector WorldLocation = Owner->GetActorTransform().TransformPosition(LocalBounds.Origin);
+	return (FMath::Square(LocalBounds.SphereRadius) / FMath::Max(1.f, FVector::DistSquared(ViewLocation, WorldLocation))) * 100.f;
+}
+
+void ADungeonCharacter::UpdateNetLOD()
+{
+	if (bHasDied || !GetMesh())
+	{
+		return;
+	}
+
+	const FBoxSphereBounds LocalBounds = GetMesh()->GetCachedLocalBounds();
+	float Significance = 0.f;
+
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		FVector Location;
+		FRotator Rotator;
+		PlayerController->GetPlayerViewPoint(Location, Rotator);
+		Significance = FMath::Max(Significance, CalculateSignificance(this, LocalBounds, Location));
+	}
+
+	int32 NetLOD = NetLODList.Num() - 1;
+	for (int32 Index = 0; Index < NetLODList.Num(); Index++)
+	{
+		if (Significance >= NetLODList[Index].SignificanceThreshold)
+		{
+			NetLOD = Index;
+			break;
+		}
+	}
+
+	ApplyNetLOD(NetLOD);
+}
+
+void ADungeonCharacter::ApplyNetLOD(int32 NetLOD)
+{
+	if (NetLOD == CurrentNetLOD || !NetLODList.IsValidIndex(NetLOD))
+	{
+		return;
+	}
+
+	const bool bIncreasedDetail = CurrentNetLOD == INDEX_NONE || NetLOD < CurrentNetLOD;
+	CurrentNetLOD = NetLOD;
+	const FDungeonCharacterNetLOD& NetLODSettings = NetLODList[NetLOD];
+
+	const ADungeonCharacter* DefaultObject = GetClass()->GetDefaultObject<ADungeonCharacter>();
+	NetUpdateFrequency = FMath::Max(1.f, DefaultObject->NetUpdateFrequency * NetLODSettings.NetUpdateFrequencyScale);
+	MinNetUpdateFrequency = FMath::Min(DefaultObject->MinNetUpdateFrequency, NetUpdateFrequency);
+
+	//ReplicatedMovement quantization is deliberately not part of a net LOD. FRepMovement::NetSerialize does not send it, so clients always decode with the class default.
+
+	if (UStatusComponent* StatusComponent = GetStatusComponent())
+	{
+		StatusComponent->SetDeferNonCriticalReplication(NetLODSettings.bDeferNonCriticalReplication);
+	}
+
+	//Get the more detailed state out right away rather than waiting for the previous (slower) update rate.
+	if (bIncreasedDetail)
+	{
+		ForceNetUpdate();
+	}
+}
+
 TSubclassOf<UDungeonCharacterDescription> ADungeonCharacter::GetCharacterDescriptor(TSubclassOf<ADungeonCharacter> DungeonCharacterClass)
 {
 	if (!DungeonCharacterClass)
@@ -1,8 +1,11 @@
 // Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
 
 #include "Gameplay/Ability/AbilityTypes.h"
+#include "NauseaDungeon.h"
 #include "Gameplay/AbilityComponent.h"
 #include "GameFramework/GameState.h"
+#include "Algo/IsSorted.h"
+#include "Algo/Sort.h"
 
 FAbilityData FAbilityData::InvalidAbilityData = FAbilityData();
 FAbilityTargetData FAbilityTargetData::InvalidTargetData = FAbilityTargetData();
@@ -10,6 +13,77 @@ FAbilityTargetData FAbilityTargetData::InvalidTargetData = FAbilityTargetData();
 uint64 FAbilityInstanceHandle::HandleIDCounter = MAX_uint64;
 uint64 FAbilityTargetDataHandle::HandleIDCounter = MAX_uint64;
 
+DECLARE_CYCLE_STAT(TEXT("Target Data Net Serialize"), STAT_AbilityTargetDataNetSerialize, STATGROUP_AbilityComponent);
+DECLARE_CYCLE_STAT(TEXT("Update Target Data Cache"), STAT_AbilityUpdateTargetDataCache, STATGROUP_AbilityComponent);
+
+namespace
+{
+	float GetLocationQuantizationScale(ETargetDataQuantization Quantization)
+	{
+		return Quantization == ETargetDataQuantization::Medium ? 10.f : 1.f;
+	}
+
+	//Rounds a location to the grid the given quantization serializes to. Deltas are taken against quantized locations so that error does not accumulate down the target data list.
+	FVector QuantizeLocation(const FVector& Location, ETargetDataQuantization Quantization)
+	{
+		const float Scale = GetLocationQuantizationScale(Quantization);
+		return FVector(FMath::RoundToFloat(Location.X * Scale) / Scale, FMath::RoundToFloat(Location.Y * Scale) / Scale, FMath::RoundToFloat(Location.Z * Scale) / Scale);
+	}
+
+	void SerializeQuantizedTransform(FArchive& Ar, FTransform& Transform, ETargetDataQuantization Quantization, const FTransform* PreviousTransform)
+	{
+		const bool bIsSaving = Ar.IsSaving();
+
+		FVector Location = Transform.GetLocation();
+		const FVector PreviousLocation = PreviousTransform ? QuantizeLocation(PreviousTransform->GetLocation(), Quantization) : FVector::ZeroVector;
+		Location -= PreviousLocation;
+
+		if (Quantization == ETargetDataQuantization::Medium)
+		{
+			SerializePackedVector<10, 24>(Location, Ar);
+		}
+		else
+		{
+			SerializePackedVector<1, 24>(Location, Ar);
+		}
+
+		FRotator Rotation = Transform.Rotator();
+		uint8 bMatchesPreviousRotation = bIsSaving && PreviousTransform && Rotation.Equals(PreviousTransform->Rotator(), 0.f);
+		Ar.SerializeBits(&bMatchesPreviousRotation, 1);
+
+		if (bMatchesPreviousRotation)
+		{
+			Rotation = PreviousTransform->Rotator();
+		}
+		else if (Quantization == ETargetDataQuantization::Medium)
+		{
+			Rotation.SerializeCompressedShort(Ar);
+		}
+		else
+		{
+			Rotation.SerializeCompressed(Ar);
+		}
+
+		FVector Scale = Transform.GetScale3D();
+		uint8 bUnitScale = bIsSaving && Scale.Equals(FVector::OneVector);
+		Ar.SerializeBits(&bUnitScale, 1);
+
+		if (bUnitScale)
+		{
+			Scale = FVector::OneVector;
+		}
+		else
+		{
+			SerializePackedVector<100, 30>(Scale, Ar);
+		}
+
+		if (Ar.IsLoading())
+		{
+			Transform = FTransform(Rotation, Location + PreviousLocation, Scale);
+		}
+	}
+}
+
 FAbilityData::FAbilityData(UClass* InAbilityClass, float WorldTimeSeconds)
 {
 	if (!InAbilityClass)
@@ -107,29 +181,66 @@ FAbilityTargetData& FAbilityTargetData::PullAbilityInstanceData(const FAbilityIn
 
 bool FAbilityTargetData::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
+	return NetSerializeQuantized(Ar, Map, bOutSuccess, ETargetDataQuantization::None, nullptr);
+}
+
+bool FAbilityTargetData::NetSerializeQuantized(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess, ETargetDataQuantization Quantization, const FAbilityTargetData* PreviousTargetData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbilityTargetDataNetSerialize);
+
 	Ar << TargetDataHandle;
 	Ar << TargetDataType;
 
-	switch (TargetDataType)
-	{
-	case ETargetDataType::Actor:
-		Ar << TargetActor;
-		break;
-	case ETargetDataType::ActorRelativeTransform:
-		Ar << TargetActor;
-		Ar << TargetTransform;
-		break;
-	case ETargetDataType::Transform:
-		Ar << TargetTransform;
-		break;
-	case ETargetDataType::MovingTransform:
-		Ar << TargetTransform;
-		Ar << DestinationTargetTransform;
-		Ar << MoveTime;
-		break;
-	default:
-		check(false);
-		break;
+	if (Quantization == ETargetDataQuantization::None)
+	{
+		switch (TargetDataType)
+		{
+		case ETargetDataType::Actor:
+			Ar << TargetActor;
+			break;
+		case ETargetDataType::ActorRelativeTransform:
+			Ar << TargetActor;
+			Ar << TargetTransform;
+			break;
+		case ETargetDataType::Transform:
+			Ar << TargetTransform;
+			break;
+		case ETargetDataType::MovingTransform:
+			Ar << TargetTransform;
+			Ar << DestinationTargetTransform;
+			Ar << MoveTime;
+			break;
+		default:
+			check(false);
+			break;
+		}
+	}
+	else
+	{
+		//Only delta encode against target data of the same type, otherwise the transforms aren't in the same space.
+		const FTransform* PreviousTransform = PreviousTargetData && PreviousTargetData->TargetDataType == TargetDataType ? &PreviousTargetData->TargetTransform : nullptr;
+
+		switch (TargetDataType)
+		{
+		case ETargetDataType::Actor:
+			Ar << TargetActor;
+			break;
+		case ETargetDataType::ActorRelativeTransform:
+			Ar << TargetActor;
+			SerializeQuantizedTransform(Ar, TargetTransform, Quantization, PreviousTransform);
+			break;
+		case ETargetDataType::Transform:
+			SerializeQuantizedTransform(Ar, TargetTransform, Quantization, PreviousTransform);
+			break;
+		case ETargetDataType::MovingTransform:
+			SerializeQuantizedTransform(Ar, TargetTransform, Quantization, PreviousTransform);
+			SerializeQuantizedTransform(Ar, DestinationTargetTransform, Quantization, &TargetTransform);
+			Ar << MoveTime;
+			break;
+		default:
+			check(false);
+			break;
+		}
 	}
 
 	const bool bIsSaving = Ar.IsSaving();
@@ -140,13 +251,27 @@ bool FAbilityTargetData::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool
 	return true;
 }
 
+inline bool SortTargetDataByHandle(const FAbilityTargetData& A, const FAbilityTargetData& B)
+{
+	return A.GetHandle() < B.GetHandle();
+}
+
+void FAbilityTargetDataContainer::SortTargetDataList()
+{
+	if (!Algo::IsSorted(TargetDataList, &SortTargetDataByHandle))
+	{
+		Algo::Sort(TargetDataList, &SortTargetDataByHandle);
+	}
+}
+
 void FAbilityTargetDataContainer::UpdateTargetDataCache(TArray<FAbilityTargetData>& AddedTargetData, TArray<FAbilityTargetData>& RemovedTargetData) const
 {
-	TMap<FAbilityTargetDataHandle, FAbilityTargetData> NewTargetDataListCache;
-	NewTargetDataListCache.Reserve(TargetDataList.Num());
-	for (const FAbilityTargetData& TargetData : TargetDataList)
+	SCOPE_CYCLE_COUNTER(STAT_AbilityUpdateTargetDataCache);
+
+	//Lists are replicated in sorted order so this should only happen if something reordered the list locally.
+	if (!Algo::IsSorted(TargetDataList, &SortTargetDataByHandle))
 	{
-		NewTargetDataListCache.Add(TargetData.GetHandle()) = TargetData;
+		const_cast<FAbilityTargetDataContainer*>(this)->SortTargetDataList();
 	}
 
 	if (TargetDataListCache.Num() == 0)
@@ -155,28 +280,70 @@ void FAbilityTargetDataContainer::UpdateTargetDataCache(TArray<FAbilityTargetDat
 	}
 	else
 	{
-		AddedTargetData.Reserve(NewTargetDataListCache.Num());
-		for (const TPair<FAbilityTargetDataHandle, FAbilityTargetData>& NewEntry : NewTargetDataListCache)
+		int32 NewIndex = 0;
+		int32 CachedIndex = 0;
+		while (NewIndex < TargetDataList.Num() && CachedIndex < TargetDataListCache.Num())
 		{
-			if (!TargetDataListCache.Contains(NewEntry.Key))
+			const FAbilityTargetDataHandle NewHandle = TargetDataList[NewIndex].GetHandle();
+			const FAbilityTargetDataHandle CachedHandle = TargetDataListCache[CachedIndex].GetHandle();
+
+			if (NewHandle < CachedHandle)
 			{
-				AddedTargetData.Add(NewEntry.Value);
+				AddedTargetData.Add(TargetDataList[NewIndex++]);
+			}
+			else if (CachedHandle < NewHandle)
+			{
+				RemovedTargetData.Add(TargetDataListCache[CachedIndex++]);
+			}
+			else
+			{
+				NewIndex++;
+				CachedIndex++;
 			}
 		}
-		AddedTargetData.Shrink();
 
-		RemovedTargetData.Reserve(TargetDataListCache.Num());
-		for (const TPair<FAbilityTargetDataHandle, FAbilityTargetData>& CachedEntry : TargetDataListCache)
+		for (; NewIndex < TargetDataList.Num(); NewIndex++)
 		{
-			if (!NewTargetDataListCache.Contains(CachedEntry.Key))
-			{
-				RemovedTargetData.Add(CachedEntry.Value);
-			}
+			AddedTargetData.Add(TargetDataList[NewIndex]);
+		}
+
+		for (; CachedIndex < TargetDataListCache.Num(); CachedIndex++)
+		{
+			RemovedTargetData.Add(TargetDataListCache[CachedIndex]);
+		}
+	}
+
+	const_cast<FAbilityTargetDataContainer*>(this)->TargetDataListCache = TargetDataList;
+}
+
+bool FAbilityTargetDataContainer::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 QuantizationValue = uint8(Quantization);
+	Ar.SerializeBits(&QuantizationValue, 2);
+	Quantization = ETargetDataQuantization(QuantizationValue);
+
+	//Never write more than a receiver will accept. GenerateInstanceData already clamps, this covers lists grown after the fact.
+	uint32 TargetDataCount = FMath::Min(TargetDataList.Num(), MaxReplicatedTargetDataCount);
+	Ar.SerializeIntPacked(TargetDataCount);
+
+	if (Ar.IsLoading())
+	{
+		if (TargetDataCount > MaxReplicatedTargetDataCount || Quantization >= ETargetDataQuantization::MAX)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
 		}
-		RemovedTargetData.Shrink();
+
+		TargetDataList.SetNum(TargetDataCount);
+	}
+
+	for (int32 Index = 0; Index < int32(TargetDataCount); Index++)
+	{
+		TargetDataList[Index].NetSerializeQuantized(Ar, Map, bOutSuccess, Quantization, Index > 0 ? &TargetDataList[Index - 1] : nullptr);
 	}
 
-	const_cast<FAbilityTargetDataContainer*>(this)->TargetDataListCache = NewTargetDataListCache;
+	return true;
 }
 
 const UAbilityInfo* FAbilityInstanceData::GetClassCDO() const
@@ -190,6 +357,20 @@ FAbilityInstanceData FAbilityInstanceData::GenerateInstanceData(UClass* InAbilit
 
 	AbilityInstanceData.InstanceHandle = FAbilityInstanceHandle::GenerateHandle();
 
+	//Receivers reject target data lists over this size, so drop the excess here rather than have the whole instance fail to replicate.
+	TArray<FAbilityTargetData>& TargetDataList = AbilityInstanceData.TargetData.GetTargetDataList();
+	if (TargetDataList.Num() > FAbilityTargetDataContainer::MaxReplicatedTargetDataCount)
+	{
+		UE_LOG(LogNauseaDungeon, Warning, TEXT("FAbilityInstanceData::GenerateInstanceData: %s generated %i target data entries, only the first %i will be used."),
+			*GetNameSafe(InAbilityClass), TargetDataList.Num(), FAbilityTargetDataContainer::MaxReplicatedTargetDataCount);
+		TargetDataList.SetNum(FAbilityTargetDataContainer::MaxReplicatedTargetDataCount);
+	}
+
+	if (const UAbilityInfo* AbilityInfoCDO = AbilityInstanceData.GetClassCDO())
+	{
+		AbilityInstanceData.TargetData.SetQuantization(AbilityInfoCDO->GetTargetDataQuantization());
+	}
+
 	if (OutHandle)
 	{
 		*OutHandle = AbilityInstanceData.InstanceHandle;
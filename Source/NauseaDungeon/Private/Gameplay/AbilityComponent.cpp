@@ -13,6 +13,14 @@
 #include "Gameplay/Ability/AbilityAction.h"
 #include "AI/ActionBrainDataObject.h"
 
+DECLARE_CYCLE_STAT(TEXT("Perform Ability"), STAT_AbilityComponentPerformAbility, STATGROUP_AbilityComponent);
+DECLARE_CYCLE_STAT(TEXT("Process Instance Data Added"), STAT_AbilityComponentProcessInstanceDataAdded, STATGROUP_AbilityComponent);
+DECLARE_CYCLE_STAT(TEXT("Process Instance Data Removed"), STAT_AbilityComponentProcessInstanceDataRemoved, STATGROUP_AbilityComponent);
+DECLARE_CYCLE_STAT(TEXT("Process Instance Data Changed"), STAT_AbilityComponentProcessInstanceDataChanged, STATGROUP_AbilityComponent);
+DECLARE_CYCLE_STAT(TEXT("Target Data Startup Complete"), STAT_AbilityComponentTargetDataStartupComplete, STATGROUP_AbilityComponent);
+DECLARE_CYCLE_STAT(TEXT("Target Data Activation Complete"), STAT_AbilityComponentTargetDataActivationComplete, STATGROUP_AbilityComponent);
+DECLARE_CYCLE_STAT(TEXT("Target Data Destruction"), STAT_AbilityComponentTargetDataDestruction, STATGROUP_AbilityComponent);
+
 void FAbilityObjectContainer::Add(TScriptInterface<IAbilityObjectInterface> Instance)
 {
 	AbilityObjectArray.Add(Instance.GetObject());
@@ -200,6 +208,8 @@ EAbilityRequestResponse UAbilityComponent::CanPerformAbility(const FAbilityInsta
 
 EAbilityRequestResponse UAbilityComponent::PerformAbility(FAbilityInstanceData&& AbilityInstanceData, bool bNotify)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AbilityComponentPerformAbility);
+
 	const EAbilityRequestResponse Response = CanPerformAbility(AbilityInstanceData);
 
 	if (Response != EAbilityRequestResponse::Success)
@@ -705,6 +715,8 @@ const FAbilityData& UAbilityComponent::GetAbilityDataByClass(TSubclassOf<UAbilit
 
 void UAbilityComponent::ProcessInstanceDataAdded(const FAbilityInstanceData& InstanceData)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AbilityComponentProcessInstanceDataAdded);
+
 	if (!HasBegunPlay())
 	{
 		return;
@@ -760,6 +772,8 @@ void UAbilityComponent::ProcessInstanceDataAdded(const FAbilityInstanceData& Ins
 
 void UAbilityComponent::ProcessInstanceDataRemoved(const FAbilityInstanceData& InstanceData)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AbilityComponentProcessInstanceDataRemoved);
+
 	if (!InstanceData.GetClass())
 	{
 		return;
@@ -791,6 +805,8 @@ void UAbilityComponent::ProcessInstanceDataRemoved(const FAbilityInstanceData& I
 
 void UAbilityComponent::ProcessInstanceDataChanged(const FAbilityInstanceData& InstanceData)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AbilityComponentProcessInstanceDataChanged);
+
 	if (!InstanceData.GetClass())
 	{
 		return;
@@ -887,6 +903,8 @@ void UAbilityComponent::ProcessInstanceTargetDataRemoved(const FAbilityInstanceD
 
 void UAbilityComponent::OnTargetDataStartupComplete(FAbilityInstanceHandle InstanceHandle, FAbilityTargetDataHandle TargetDataHandle)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AbilityComponentTargetDataStartupComplete);
+
 	FAbilityInstanceData* OwningAbilityInstanceData = nullptr;
 	FAbilityTargetData* OwningAbilityTargetData = nullptr;
 
@@ -937,6 +955,8 @@ void UAbilityComponent::OnTargetDataStartupComplete(FAbilityInstanceHandle Insta
 
 void UAbilityComponent::OnTargetDataActivationComplete(FAbilityInstanceHandle InstanceHandle, FAbilityTargetDataHandle TargetDataHandle)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AbilityComponentTargetDataActivationComplete);
+
 	FAbilityInstanceData* OwningAbilityInstanceData = nullptr;
 	FAbilityTargetData* OwningAbilityTargetData = nullptr;
 
@@ -1011,6 +1031,8 @@ void UAbilityComponent::OnTargetDataActivationComplete(FAbilityInstanceHandle In
 
 void UAbilityComponent::OnTargetDataDestructionReady(FAbilityInstanceHandle InstanceHandle, FAbilityTargetDataHandle TargetDataHandle)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AbilityComponentTargetDataDestruction);
+
 	int32 OwningAbilityInstanceIndex = INDEX_NONE;
 
 	for (int32 Index = AbilityInstanceDataContainer->Num() - 1; Index >= 0; Index--)
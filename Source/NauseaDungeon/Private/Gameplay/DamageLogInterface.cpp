@@ -76,10 +76,32 @@ FText UDamageLogStatics::GetDamageLogModificationText(FDamageLogEventModifier Da
 	return GenerateDamageLogEventModifierText(DamageLogEventModifier);
 }
 
-static FText DamageLogEventText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event");
-static FText DamageLogEventWithWeaponText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_WithWeapon");
+TArray<FText> UDamageLogStatics::GetDamageLogModificationTextList(FDamageLogEvent DamageLogEvent)
+{
+	TArray<FText> ModificationTextList;
+	ModificationTextList.Reserve(DamageLogEvent.GetModifierList().Num());
+
+	for (const FDamageLogEventModifier& Modifier : DamageLogEvent.GetModifierList())
+	{
+		FText ModificationText = GenerateDamageLogEventModifierText(Modifier);
+
+		if (ModificationText.IsEmpty())
+		{
+			continue;
+		}
+
+		ModificationTextList.Add(MoveTemp(ModificationText));
+	}
+
+	return ModificationTextList;
+}
+
+//Text is only generated when a consumer asks for it, so string table entries are resolved on first use rather than during static initialization.
 FText UDamageLogStatics::GenerateDamageLogEventText(const FDamageLogEvent& DamageLogEvent)
 {
+	static const FText DamageLogEventText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event");
+	static const FText DamageLogEventWithWeaponText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_WithWeapon");
+
 	TScriptInterface<IDamageLogInterface> InstigatorInterface = GetCDOFromObjectOrClass(DamageLogEvent.Instigator.Get());
 	if (!TSCRIPTINTERFACE_IS_VALID(InstigatorInterface))
 	{
@@ -106,12 +128,13 @@ FText UDamageLogStatics::GenerateDamageLogEventText(const FDamageLogEvent& Damag
 	return FText::GetEmpty();
 }
 
-static FText DamageLogModificationIncreaseText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Increase");
-static FText DamageLogModificationDecreaseText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Decrease");
-static FText DamageLogModificationIncreaseWithInstigatorText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Increase_With_Instigator");
-static FText DamageLogModificationDecreaseWithInstigatorText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Decrease_With_Instigator");
 FText UDamageLogStatics::GenerateDamageLogEventModifierText(const FDamageLogEventModifier& DamageLogEventModifier)
 {
+	static const FText DamageLogModificationIncreaseText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Increase");
+	static const FText DamageLogModificationDecreaseText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Decrease");
+	static const FText DamageLogModificationIncreaseWithInstigatorText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Increase_With_Instigator");
+	static const FText DamageLogModificationDecreaseWithInstigatorText = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Event_Modification_Decrease_With_Instigator");
+
 	TScriptInterface<IDamageLogInterface> ModificationInterface = GetCDOFromObjectOrClass(DamageLogEventModifier.DataObject.Get());
 	TScriptInterface<IDamageLogInterface> ModificationInstigatorInterface = DamageLogEventModifier.InstigatorObject.Get();
 	if (!TSCRIPTINTERFACE_IS_VALID(ModificationInterface))
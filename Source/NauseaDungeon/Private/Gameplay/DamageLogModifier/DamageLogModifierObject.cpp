@@ -10,56 +10,66 @@ UDamageLogModifierObject::UDamageLogModifierObject(const FObjectInitializer& Obj
 
 }
 
+FText UDamageLogModifierObject::GetDamageLogInstigatorName() const
+{
+	if (!InstigatorName.IsEmpty() || InstigatorNameTableKey.IsEmpty())
+	{
+		return InstigatorName;
+	}
+
+	return FText::FromStringTable(TEXT("/Game/Localization/DamageLogStringTable.DamageLogStringTable"), InstigatorNameTableKey);
+}
+
 UArmorDamageLogModifier::UArmorDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_Armor");
+	InstigatorNameTableKey = TEXT("Modification_Armor");
 }
 
 UWeakpointDamageLogModifier::UWeakpointDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_Weakpoint");
+	InstigatorNameTableKey = TEXT("Modification_Weakpoint");
 }
 
 UPartDestroyedFlatDamageLogModifier::UPartDestroyedFlatDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_PartDestroyedFlatDamage");
+	InstigatorNameTableKey = TEXT("Modification_PartDestroyedFlatDamage");
 }
 
 UPartDestroyedPercentDamageLogModifier::UPartDestroyedPercentDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_PartDestroyedPercentDamage");
+	InstigatorNameTableKey = TEXT("Modification_PartDestroyedPercentDamage");
 }
 
 UPartWeaknessDamageLogModifier::UPartWeaknessDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_PartDamageWeakness");
+	InstigatorNameTableKey = TEXT("Modification_PartDamageWeakness");
 }
 
 UPartResistanceDamageLogModifier::UPartResistanceDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_PartDamageResistance");
+	InstigatorNameTableKey = TEXT("Modification_PartDamageResistance");
 }
 
 UWeaknessDamageLogModifier::UWeaknessDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_DamageWeakness");
+	InstigatorNameTableKey = TEXT("Modification_DamageWeakness");
 }
 
 UResistanceDamageLogModifier::UResistanceDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_DamageResistance");
+	InstigatorNameTableKey = TEXT("Modification_DamageResistance");
 }
 
 UFriendlyFireScalingDamageLogModifier::UFriendlyFireScalingDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_FriendlyFireScaling");
+	InstigatorNameTableKey = TEXT("Modification_FriendlyFireScaling");
 }
\ No newline at end of file
@@ -74,6 +74,7 @@ UStatusComponent::UStatusComponent(const FObjectInitializer& ObjectInitializer)
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 
 	SetIsReplicatedByDefault(true);
+	SetUseReplicationDirtyGeneration(true);
 
 	bWantsInitializeComponent = true;
 
@@ -100,13 +101,13 @@ void UStatusComponent::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > &
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, Health, PushReplicationParams::Default);
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, HealthMovementSpeedModifier, PushReplicationParams::InitialOnly);
-	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, PartHealthList, PushReplicationParams::Default);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, PartHealthList, PushReplicationParams::Custom);
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, Armour, PushReplicationParams::Default);
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, ArmourAbsorption, PushReplicationParams::InitialOnly);
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, ArmourDecay, PushReplicationParams::InitialOnly);
 
-	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, HitEventList, PushReplicationParams::Default);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, HitEventList, PushReplicationParams::Custom);
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, PartDestroyedEventList, PushReplicationParams::Default);
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusComponent, DeathEvent, PushReplicationParams::Default);
 
@@ -148,11 +149,53 @@ bool UStatusComponent::ReplicateSubobjects(class UActorChannel* Channel, class F
 	return Super::ReplicateSubobjects(Channel, Bunch, RepFlags) || bWroteSomething;
 }
 
+void UStatusComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	bool bReplicateHitEvents = !bDeferNonCriticalReplication;
+	bool bReplicatePartHealth = !bDeferNonCriticalReplication;
+
+	if (bDeferNonCriticalReplication && GetWorld()->GetTimeSeconds() >= NextDeferredReplicationTime)
+	{
+		NextDeferredReplicationTime = GetWorld()->GetTimeSeconds() + DeferredReplicationInterval;
+		bReplicatePartHealth = true;
+	}
+
+	//Properties that were inactive may have changed without being compared so make sure they're looked at once they are active again.
+	if (bReplicateHitEvents && !bReplicatingHitEvents)
+	{
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, HitEventList, this);
+	}
+
+	if (bReplicatePartHealth && !bReplicatingPartHealth)
+	{
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, PartHealthList, this);
+	}
+
+	bReplicatingHitEvents = bReplicateHitEvents;
+	bReplicatingPartHealth = bReplicatePartHealth;
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UStatusComponent, HitEventList, bReplicatingHitEvents);
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UStatusComponent, PartHealthList, bReplicatingPartHealth);
+}
+
+void UStatusComponent::SetDeferNonCriticalReplication(bool bInDeferNonCriticalReplication)
+{
+	if (bDeferNonCriticalReplication == bInDeferNonCriticalReplication)
+	{
+		return;
+	}
+
+	bDeferNonCriticalReplication = bInDeferNonCriticalReplication;
+	NextDeferredReplicationTime = GetWorld()->GetTimeSeconds() + DeferredReplicationInterval;
+}
+
 void UStatusComponent::SetGenericTeamId(const FGenericTeamId& NewTeamID)
 {
 	TeamId = NewTeamID;
 	OnRep_TeamId();
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, TeamId, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, TeamId, this);
 }
 
 void UStatusComponent::SetPlayerDefaults()
@@ -384,6 +427,18 @@ void UStatusComponent::OnStatusEffectAdded(UStatusEffectBase* StatusEffect)
 {
 	RegisterReplicatedSubobject(StatusEffect);
 	StatusEffectList.AddUnique(StatusEffect);
+
+	if (StatusEffect)
+	{
+		StatusEffectClassMap.Add(StatusEffect->GetClass(), StatusEffect);
+
+		UStatusEffectBase** PooledStatusEffect = PooledStatusEffectMap.Find(StatusEffect->GetClass());
+
+		if (PooledStatusEffect && *PooledStatusEffect == StatusEffect)
+		{
+			PooledStatusEffectMap.Remove(StatusEffect->GetClass());
+		}
+	}
 }
 
 void UStatusComponent::OnStatusEffectRemoved(UStatusEffectBase* StatusEffect)
@@ -391,6 +446,52 @@ void UStatusComponent::OnStatusEffectRemoved(UStatusEffectBase* StatusEffect)
 	UnregisterReplicatedSubobject(StatusEffect);
 	StatusEffectList.Remove(StatusEffect);
 	StatusEffectList.Remove(nullptr);
+
+	if (StatusEffect)
+	{
+		UStatusEffectBase** IndexedStatusEffect = StatusEffectClassMap.Find(StatusEffect->GetClass());
+
+		if (IndexedStatusEffect && *IndexedStatusEffect == StatusEffect)
+		{
+			StatusEffectClassMap.Remove(StatusEffect->GetClass());
+		}
+	}
+}
+
+bool UStatusComponent::ReturnStatusEffectToPool(UStatusEffectBase* StatusEffect)
+{
+	if (!StatusEffect || !bPoolStatusEffects || IsBeingDestroyed())
+	{
+		return false;
+	}
+
+	//Clients only pool status effects the server has pooled so that both sides keep the same object alive.
+	if (GetOwnerRole() != ROLE_Authority && !StatusEffect->IsPooled() && !StatusEffect->IsPendingPoolReturn())
+	{
+		return false;
+	}
+
+	UStatusEffectBase*& PooledStatusEffect = PooledStatusEffectMap.FindOrAdd(StatusEffect->GetClass());
+
+	if (PooledStatusEffect == StatusEffect)
+	{
+		return true;
+	}
+
+	if (PooledStatusEffect && !PooledStatusEffect->IsPendingKill())
+	{
+		return false;
+	}
+
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		//Pooled status effects stay registered so their reset state replicates.
+		RegisterReplicatedSubobject(StatusEffect);
+	}
+
+	StatusEffect->ResetForReuse();
+	PooledStatusEffect = StatusEffect;
+	return true;
 }
 
 float UStatusComponent::SetHealth(float InHealth)
@@ -402,7 +503,7 @@ float UStatusComponent::SetHealth(float InHealth)
 
 	const float CurrentHealth = Health.SetValue(InHealth);
 	OnRep_Health();
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Health, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Health, this);
 	return Health;
 }
 
@@ -415,7 +516,7 @@ float UStatusComponent::SetMaxHealth(float InMaxHealth)
 	if (Health != PreviousHealthValue)
 	{
 		OnRep_Health();
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Health, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Health, this);
 	}
 
 	return Health;
@@ -430,7 +531,7 @@ float UStatusComponent::SetArmour(float InArmour)
 	if (Armour != PreviousArmourValue)
 	{
 		OnRep_Armour();
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Armour, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Armour, this);
 	}
 
 	return Armour;
@@ -445,7 +546,7 @@ float UStatusComponent::SetMaxArmour(float InMaxArmour)
 	if (Armour.GetMaxValue() != PreviousMaxArmourValue)
 	{
 		OnRep_Armour();
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Armour, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Armour, this);
 	}
 
 	return Armour;
@@ -595,6 +696,7 @@ void UStatusComponent::TakeDamage(AActor* Actor, float& DamageAmount, FDamageEve
 
 	HandleDamageTypeStatus(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
 	
+	float GeneratedThreat = 0.f;
 	if (UAIPerceptionSystem* PerceptionSystem = UAIPerceptionSystem::GetCurrent(this))
 	{
 		//Threat generating damage must be using a core damage type.
@@ -602,10 +704,10 @@ void UStatusComponent::TakeDamage(AActor* Actor, float& DamageAmount, FDamageEve
 
 		if (const UCoreDamageType* CoreDamageTypeCDO = CoreDamageTypeClass.GetDefaultObject())
 		{
-			float GeneratedThreat = CoreDamageTypeCDO->GetThreatAmount(DamageAmount);
+			GeneratedThreat = CoreDamageTypeCDO->GetThreatAmount(DamageAmount);
 			OnProcessThreatApplied.Broadcast(this, GeneratedThreat, DamageEvent, EventInstigatorPlayerState);
 
-			if (GeneratedThreat > 0.f)
+			if (GeneratedThreat > 0.f && !bAggregateDamageEvents)
 			{
 				FAIDamageEvent Event(GetOwner(), EventInstigator ? EventInstigator->GetPawn() : nullptr, GeneratedThreat, PerceptionInfo.InstigationLocation, PerceptionInfo.HitLocation);
 				PerceptionSystem->OnEvent(Event);
@@ -624,7 +726,15 @@ void UStatusComponent::TakeDamage(AActor* Actor, float& DamageAmount, FDamageEve
 	});
 
 	const FVector DamageDirection = GetDamageDirection(PerceptionInfo);
-	GenerateHitEvent(FHitEvent(TSubclassOf<UCoreDamageType>(DamageEvent.DamageTypeClass), DamageAmount, DamageDirection, PerceptionInfo.HitLocation, GetWorld()->GetTimeSeconds(), FRandomStream(FMath::Rand())));
+
+	if (bAggregateDamageEvents)
+	{
+		AggregateDamageEvent(DamageAmount, GeneratedThreat, DamageEvent, EventInstigator, DamageCauser, PerceptionInfo.InstigationLocation, PerceptionInfo.HitLocation, DamageDirection);
+	}
+	else
+	{
+		GenerateHitEvent(FHitEvent(TSubclassOf<UCoreDamageType>(DamageEvent.DamageTypeClass), DamageAmount, DamageDirection, PerceptionInfo.HitLocation, GetWorld()->GetTimeSeconds(), FRandomStream(FMath::Rand())));
+	}
 
 	SetHealth(Health - DamageAmount);
 
@@ -645,7 +755,15 @@ void UStatusComponent::TakeDamage(AActor* Actor, float& DamageAmount, FDamageEve
 		DamageNoise.MakeNoise(GetOwner());
 	}
 
-	OnDamageReceived.Broadcast(this, DamageAmount, DamageEvent, EventInstigator, DamageCauser);
+	if (!bAggregateDamageEvents)
+	{
+		OnDamageReceived.Broadcast(this, DamageAmount, DamageEvent, EventInstigator, DamageCauser);
+	}
+	else if (IsDead())
+	{
+		//Deliver what has been aggregated so far before death is processed.
+		FlushAggregatedDamageEvents();
+	}
 
 	if (IsDead())
 	{
@@ -695,7 +813,7 @@ void UStatusComponent::HandlePointDamage(AActor* Actor, float& DamageAmount, FPo
 	}
 
 	HitPart -= DamageAmount;
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, PartHealthList, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, PartHealthList, this);
 
 	if (HitPart <= 0.f)
 	{
@@ -793,22 +911,40 @@ void UStatusComponent::HandleDamageTypeStatus(float Damage, struct FDamageEvent
 		return;
 	}
 
+	//Copied since applying a status effect can apply damage of a new damage type and grow the table.
+	const TArray<FDamageTypeStatusEffectEntry, TInlineAllocator<8>> StatusEntryList(GetDamageTypeStatusEffectList(CoreDamageType));
+
+	for (const FDamageTypeStatusEffectEntry& StatusEntry : StatusEntryList)
+	{
+		AddStatusEffect(StatusEntry.StatusEffectClass, DamageEvent, EventInstigator, StatusEntry.Power * EffectPowerMultiplier);
+	}
+}
+
+const TArray<FDamageTypeStatusEffectEntry>& UStatusComponent::GetDamageTypeStatusEffectList(const UCoreDamageType* CoreDamageType)
+{
+	if (const FDamageTypeStatusEffectList* CachedList = DamageTypeStatusEffectTable.Find(CoreDamageType->GetClass()))
+	{
+		return CachedList->EntryList;
+	}
+
+	TArray<FDamageTypeStatusEffectEntry>& EntryList = DamageTypeStatusEffectTable.Add(CoreDamageType->GetClass()).EntryList;
+
 	const TMap<EStatusType, float>& DamageTypeGenericStatusEffectMap = CoreDamageType->GetGenericStatusEffectMap();
 
 	for (const TPair<EStatusType, float>& GenericStatusEffect : DamageTypeGenericStatusEffectMap)
 	{
-		if (!GenericStatusEffectMap.Contains(GenericStatusEffect.Key))
+		const TSubclassOf<UStatusEffectBase>* GenericStatusEffectClass = GenericStatusEffectMap.Find(GenericStatusEffect.Key);
+
+		if (!GenericStatusEffectClass || !(*GenericStatusEffectClass))
 		{
 			continue;
 		}
-		
-		float EffectPower = GenericStatusEffect.Value * EffectPowerMultiplier;
-		if (GenericStatusEffectMultiplierMap.Contains(GenericStatusEffect.Key))
-		{
-			EffectPower *= GenericStatusEffectMultiplierMap[GenericStatusEffect.Key];
-		}
 
-		AddStatusEffect(GenericStatusEffectMap[GenericStatusEffect.Key], DamageEvent, EventInstigator, EffectPower);
+		const float* GenericStatusEffectMultiplier = GenericStatusEffectMultiplierMap.Find(GenericStatusEffect.Key);
+
+		FDamageTypeStatusEffectEntry& Entry = EntryList.AddDefaulted_GetRef();
+		Entry.StatusEffectClass = *GenericStatusEffectClass;
+		Entry.Power = GenericStatusEffect.Value * (GenericStatusEffectMultiplier ? *GenericStatusEffectMultiplier : 1.f);
 	}
 
 	const TMap<TSoftClassPtr<UStatusEffectBase>, float>& DamageTypeStatusEffectMap = CoreDamageType->GetStatusEffectMap();
@@ -822,8 +958,12 @@ void UStatusComponent::HandleDamageTypeStatus(float Damage, struct FDamageEvent
 			continue;
 		}
 
-		AddStatusEffect(StatusEntry.Key.Get(), DamageEvent, EventInstigator, StatusEntry.Value * EffectPowerMultiplier);
+		FDamageTypeStatusEffectEntry& Entry = EntryList.AddDefaulted_GetRef();
+		Entry.StatusEffectClass = StatusEffectClass;
+		Entry.Power = StatusEntry.Value;
 	}
+
+	return EntryList;
 }
 
 UStatusEffectBase* UStatusComponent::AddStatusEffect(TSubclassOf<UStatusEffectBase> StatusEffectClass, struct FDamageEvent const& DamageEvent, AController* EventInstigator, float Power)
@@ -842,14 +982,11 @@ UStatusEffectBase* UStatusComponent::AddStatusEffect(TSubclassOf<UStatusEffectBa
 
 	ACorePlayerState* InstigatorPlayerState = EventInstigator ? EventInstigator->GetPlayerState<ACorePlayerState>() : nullptr;
 
-	for (UStatusEffectBase* StatusEffect : StatusEffectList)
+	if (UStatusEffectBase* const* ExistingStatusEffect = StatusEffectClassMap.Find(StatusEffectClass))
 	{
-		if (!StatusEffect)
-		{
-			continue;
-		}
+		UStatusEffectBase* StatusEffect = *ExistingStatusEffect;
 
-		if (!StatusEffect->IsPendingKillOrUnreachable() && StatusEffect->GetClass() == StatusEffectClass)
+		if (StatusEffect && !StatusEffect->IsPendingKillOrUnreachable())
 		{
 			OnProcessStatusPowerTaken.Broadcast(GetOwner(), Power, DamageEvent, StatusEffect->GetStatusType());
 			if (StatusEffect->CanRefreshStatus(InstigatorPlayerState, Power))
@@ -867,7 +1004,12 @@ UStatusEffectBase* UStatusComponent::AddStatusEffect(TSubclassOf<UStatusEffectBa
 		return nullptr;
 	}
 
-	UStatusEffectBase* StatusEffect = NewObject<UStatusEffectBase>(this, StatusEffectClass);
+	UStatusEffectBase* StatusEffect = TakePooledStatusEffect(StatusEffectClass);
+
+	if (!StatusEffect)
+	{
+		StatusEffect = NewObject<UStatusEffectBase>(this, StatusEffectClass);
+	}
 
 	if (StatusEffect)
 	{
@@ -879,6 +1021,19 @@ UStatusEffectBase* UStatusComponent::AddStatusEffect(TSubclassOf<UStatusEffectBa
 	return StatusEffect;
 }
 
+UStatusEffectBase* UStatusComponent::TakePooledStatusEffect(TSubclassOf<UStatusEffectBase> StatusEffectClass)
+{
+	UStatusEffectBase* StatusEffect = nullptr;
+
+	if (!PooledStatusEffectMap.RemoveAndCopyValue(StatusEffectClass, StatusEffect) || !StatusEffect || StatusEffect->IsPendingKill())
+	{
+		return nullptr;
+	}
+
+	StatusEffect->SetPooled(false);
+	return StatusEffect;
+}
+
 void UStatusComponent::UpdateDeathEvent(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
 	DeathEvent.Damage = Damage;
@@ -901,7 +1056,7 @@ void UStatusComponent::UpdateDeathEvent(float Damage, struct FDamageEvent const&
 	}
 
 	OnRep_DeathEvent();
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, DeathEvent, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, DeathEvent, this);
 }
 
 inline void UStatusComponent::PushDamageLog(FDamageLogEvent&& Entry)
@@ -913,13 +1068,25 @@ inline FDamageLogEvent UStatusComponent::PopDamageLog(float DamageDealt)
 {
 	FDamageLogEvent PoppedDamageLog = DamageLogStack.Pop();
 	PoppedDamageLog.FinalizeDamageLog(DamageDealt);
+	DamageLogHistory.Record(PoppedDamageLog);
 	return PoppedDamageLog;
 }
 
+void UStatusComponent::GetRecentDamageLogs(TArray<FDamageLogEvent>& OutDamageLogList) const
+{
+	OutDamageLogList.Reset(DamageLogHistory.Num());
+
+	for (int32 Index = 0; Index < DamageLogHistory.Num(); Index++)
+	{
+		OutDamageLogList.Add(DamageLogHistory.Get(Index));
+	}
+}
+
 void UStatusComponent::GenerateHitEvent(FHitEvent&& InHitEvent)
 {
 	FHitEvent& HitEvent = HitEventList->Add_GetRef(MoveTemp(InHitEvent));
 	HitEventList.MarkItemDirty(HitEvent);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, HitEventList, this);
 
 	FTimerHandle DummyHandle;
 	GetWorld()->GetTimerManager().SetTimer(DummyHandle, FTimerDelegate::CreateUObject(this, &UStatusComponent::CleanupHitEvent, HitEvent.ID), 2.f, false);
@@ -938,6 +1105,69 @@ void UStatusComponent::CleanupHitEvent(uint64 ID)
 
 		HitEventList->RemoveAt(Index, 1, false);
 		HitEventList.MarkArrayDirty();
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, HitEventList, this);
+	}
+}
+
+void UStatusComponent::AggregateDamageEvent(float DamageAmount, float Threat, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser, const FVector& InstigationLocation, const FVector& HitLocation, const FVector& DamageDirection)
+{
+	if (AggregatedDamageEventList.Num() == 0)
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UStatusComponent::FlushAggregatedDamageEvents);
+	}
+
+	FAggregatedDamageEvent* AggregatedDamageEvent = AggregatedDamageEventList.FindByPredicate([EventInstigator, &DamageEvent](const FAggregatedDamageEvent& Entry)
+	{
+		return Entry.EventInstigator == EventInstigator && Entry.DamageTypeClass == DamageEvent.DamageTypeClass;
+	});
+
+	if (!AggregatedDamageEvent)
+	{
+		AggregatedDamageEvent = &AggregatedDamageEventList.AddDefaulted_GetRef();
+		AggregatedDamageEvent->EventInstigator = EventInstigator;
+		AggregatedDamageEvent->DamageTypeClass = DamageEvent.DamageTypeClass;
+	}
+
+	AggregatedDamageEvent->DamageCauser = DamageCauser;
+	AggregatedDamageEvent->Damage += DamageAmount;
+	AggregatedDamageEvent->Threat += Threat;
+	AggregatedDamageEvent->HitCount++;
+	AggregatedDamageEvent->InstigationLocation = InstigationLocation;
+	AggregatedDamageEvent->HitLocation = HitLocation;
+	AggregatedDamageEvent->DamageDirection = DamageDirection;
+}
+
+void UStatusComponent::FlushAggregatedDamageEvents()
+{
+	if (AggregatedDamageEventList.Num() == 0)
+	{
+		return;
+	}
+
+	//Listeners can apply more damage, so work off of a copy.
+	TArray<FAggregatedDamageEvent, TInlineAllocator<4>> DamageEventList = AggregatedDamageEventList;
+	AggregatedDamageEventList.Reset();
+
+	UAIPerceptionSystem* PerceptionSystem = UAIPerceptionSystem::GetCurrent(this);
+	const float WorldTimeSeconds = GetWorld()->GetTimeSeconds();
+
+	for (const FAggregatedDamageEvent& AggregatedDamageEvent : DamageEventList)
+	{
+		AController* EventInstigator = AggregatedDamageEvent.EventInstigator.Get();
+		AActor* DamageCauser = AggregatedDamageEvent.DamageCauser.Get();
+
+		if (PerceptionSystem && AggregatedDamageEvent.Threat > 0.f)
+		{
+			FAIDamageEvent Event(GetOwner(), EventInstigator ? EventInstigator->GetPawn() : nullptr, AggregatedDamageEvent.Threat, AggregatedDamageEvent.InstigationLocation, AggregatedDamageEvent.HitLocation);
+			PerceptionSystem->OnEvent(Event);
+		}
+
+		FHitEvent HitEvent(TSubclassOf<UCoreDamageType>(AggregatedDamageEvent.DamageTypeClass), AggregatedDamageEvent.Damage, AggregatedDamageEvent.DamageDirection, AggregatedDamageEvent.HitLocation, WorldTimeSeconds, FRandomStream(FMath::Rand()));
+		HitEvent.HitCount = uint8(FMath::Min(AggregatedDamageEvent.HitCount, int32(MAX_uint8)));
+		GenerateHitEvent(MoveTemp(HitEvent));
+
+		const FDamageEvent DamageEvent(AggregatedDamageEvent.DamageTypeClass);
+		OnDamageReceived.Broadcast(this, AggregatedDamageEvent.Damage, DamageEvent, EventInstigator, DamageCauser);
 	}
 }
 
@@ -1077,24 +1307,24 @@ void UStatusComponentConfigObject::ConfigureStatusComponent(UStatusComponent* St
 	StatusComponent->Health.Initialize();
 	StatusComponent->Health *= HealthScale;
 	StatusComponent->HealthMovementSpeedModifier = HealthMovementSpeedModifier;
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Health, StatusComponent);
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, HealthMovementSpeedModifier, StatusComponent);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Health, StatusComponent);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, HealthMovementSpeedModifier, StatusComponent);
 
 	StatusComponent->Armour = Armour;
 	StatusComponent->Armour.Initialize();
 	StatusComponent->Armour *= ArmourScale;
 	StatusComponent->ArmourAbsorption = ArmourAbsorption;
 	StatusComponent->ArmourDecay = ArmourDecay;
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Armour, StatusComponent);
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, ArmourAbsorption, StatusComponent);
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, ArmourDecay, StatusComponent);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, Armour, StatusComponent);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, ArmourAbsorption, StatusComponent);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, ArmourDecay, StatusComponent);
 
 	StatusComponent->HitTypeDamageMultiplier = HitTypeDamageMultiplier;
 	StatusComponent->ElementalTypeDamageMultiplier = ElementalTypeDamageMultiplier;
 
 	//Push part list to status component and initialize it here.
 	*StatusComponent->PartHealthList = PartHealthList;
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, PartHealthList, StatusComponent);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusComponent, PartHealthList, StatusComponent);
 
 	TArray<FPartStatStruct>& StatusComponentPartHealthList = *StatusComponent->PartHealthList;
 	TMap<FName, int32>& StatusComponentBonePartIndexMap = StatusComponent->BonePartIndexMap;
@@ -1145,4 +1375,6 @@ void UStatusComponentConfigObject::ConfigureStatusComponent(UStatusComponent* St
 	{
 		EffectMultiplierEntry.Value *= StatusScale;
 	}
+
+	StatusComponent->ResetDamageTypeStatusEffectTable();
 }
\ No newline at end of file
@@ -21,6 +21,7 @@ UStatusEffectBase::UStatusEffectBase(const FObjectInitializer& ObjectInitializer
 	: Super(ObjectInitializer)
 {
 	SetSkipReplicationLogic(ESkipReplicationLogic::SkipOwnerInitial);
+	SetUseReplicationDirtyGeneration(true);
 }
 
 void UStatusEffectBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -36,6 +37,8 @@ void UStatusEffectBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusEffectBase, RefreshCounter, PushReplicationParams::Default);
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusEffectBase, StatusEffectInsitgator, PushReplicationParams::Default);
 	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusEffectBase, StatusEffectInstigationDirection, PushReplicationParams::Default);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusEffectBase, bPooled, PushReplicationParams::Default);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UStatusEffectBase, PoolGeneration, PushReplicationParams::Default);
 }
 
 void UStatusEffectBase::PostInitProperties()
@@ -43,20 +46,36 @@ void UStatusEffectBase::PostInitProperties()
 	Super::PostInitProperties();
 }
 
-void UStatusEffectBase::PreNetReceive()
+void UStatusEffectBase::PostNetReceive()
 {
-	Super::PreNetReceive();
+	Super::PostNetReceive();
+
+	UStatusComponent* OuterStatusComponent = UStatusInterfaceStatics::GetStatusComponent(TScriptInterface<IStatusInterface>(GetTypedOuter<AActor>()));
+
+	//The server has pooled this status effect since our last update (and may have already reused it).
+	if (IsPendingPoolReturn())
+	{
+		if (bDoneRemotePostNetReceiveActivation)
+		{
+			OnDestroyed();
+		}
+
+		LastReceivedPoolGeneration = PoolGeneration;
+	}
+
+	if (IsPooled())
+	{
+		if (OuterStatusComponent)
+		{
+			OuterStatusComponent->ReturnStatusEffectToPool(this);
+		}
+		return;
+	}
 
 	if (!IsInitialized())
 	{
-		UStatusComponent* OuterStatusComponent = UStatusInterfaceStatics::GetStatusComponent(TScriptInterface<IStatusInterface>(GetTypedOuter<AActor>()));
 		Initialize(OuterStatusComponent, nullptr, -1.f, FAISystem::InvalidDirection);
 	}
-}
-
-void UStatusEffectBase::PostNetReceive()
-{
-	Super::PostNetReceive();
 
 	if (!bDoneRemotePostNetReceiveActivation)
 	{
@@ -142,6 +161,65 @@ void UStatusEffectBase::OnDestroyed()
 	OnDeactivated(EStatusEndType::Expired);
 }
 
+void UStatusEffectBase::ResetForReuse()
+{
+	const bool bAuthority = IsAuthority();
+	const UObject* DefaultObject = GetClass()->GetDefaultObject();
+
+	for (TFieldIterator<FProperty> PropertyIterator(GetClass()); PropertyIterator; ++PropertyIterator)
+	{
+		FProperty* Property = *PropertyIterator;
+
+		//Blueprint ubergraph frames and the like must never be shared with the CDO.
+		if (Property->HasAnyPropertyFlags(CPF_DuplicateTransient) || Property->GetFName() == GET_MEMBER_NAME_CHECKED(UStatusEffectBase, PoolGeneration))
+		{
+			continue;
+		}
+
+		//Copying an instanced reference from the CDO would point this effect at the CDO's subobject template. Keep our own instances instead.
+		if (Property->ContainsInstancedReference())
+		{
+			continue;
+		}
+
+		if (Property->HasAnyPropertyFlags(CPF_Net))
+		{
+			if (!bAuthority)
+			{
+				continue;
+			}
+
+			MARK_PROPERTY_DIRTY(this, Property);
+		}
+
+		Property->CopyCompleteValue_InContainer(this, DefaultObject);
+	}
+
+	WorldPrivate = nullptr;
+
+	if (bAuthority)
+	{
+		SetPooled(true);
+	}
+}
+
+void UStatusEffectBase::SetPooled(bool bInPooled)
+{
+	if (bPooled == bInPooled)
+	{
+		return;
+	}
+
+	bPooled = bInPooled;
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, bPooled, this);
+
+	if (bPooled)
+	{
+		PoolGeneration++;
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, PoolGeneration, this);
+	}
+}
+
 bool UStatusEffectBase::CanActivateStatus(ACorePlayerState* Instigator, float Power) const
 {
 	return true;
@@ -191,6 +269,11 @@ void UStatusEffectBase::OnDeactivated(EStatusEndType EndType)
 
 	OwningStatusComponent->OnStatusEffectRemoved(this);
 
+	if (OwningStatusComponent->ReturnStatusEffectToPool(this))
+	{
+		return;
+	}
+
 	WorldPrivate = nullptr;
 	OwningStatusComponent = nullptr;
 	MarkPendingKill();
@@ -199,14 +282,14 @@ void UStatusEffectBase::OnDeactivated(EStatusEndType EndType)
 void UStatusEffectBase::UpdateInstigator(ACorePlayerState* Instigator)
 {
 	StatusEffectInsitgator = Instigator;
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, StatusEffectInsitgator, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, StatusEffectInsitgator, this);
 	OnRep_StatusEffectInsitgator();
 }
 
 void UStatusEffectBase::UpdateInstigationDirection(const FVector& Direction)
 {
 	StatusEffectInstigationDirection = Direction;
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, StatusEffectInstigationDirection, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, StatusEffectInstigationDirection, this);
 	OnRep_StatusEffectInstigationDirection();
 }
 
@@ -500,6 +583,11 @@ void UStatusEffectBase::OnOwnerDied(UStatusComponent* StatusComponent, float Dam
 
 void UStatusEffectBase::OnRep_RefreshCounter()
 {
+	if (!IsInitialized() || IsPooled())
+	{
+		return;
+	}
+
 	OnActivated(EStatusBeginType::Refresh);
 }
 
@@ -598,7 +686,7 @@ void UStatusEffectBasic::Initialize(UStatusComponent* StatusComponent, ACorePlay
 	if (Power != -1.f)
 	{
 		CurrentPower = Power;
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
 	}
 
 	if (bK2TickImplemented)
@@ -637,6 +725,14 @@ void UStatusEffectBasic::OnDestroyed()
 	OnDeactivated(bWasInterrupted ? EStatusEndType::Interrupted : EStatusEndType::Expired);
 }
 
+void UStatusEffectBasic::ResetForReuse()
+{
+	TickType = ETickableTickType::Never;
+	ProcessDamageHandle.Reset();
+
+	Super::ResetForReuse();
+}
+
 void UStatusEffectBasic::OnActivated(EStatusBeginType BeginType)
 {
 	if (IsAuthority())
@@ -660,7 +756,7 @@ void UStatusEffectBasic::OnActivated(EStatusBeginType BeginType)
 		}
 		
 		OnRep_StatusTime();
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, StatusTime, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, StatusTime, this);
 	}
 
 	if (PowerDecayDelay > 0.f)
@@ -766,7 +862,7 @@ void UStatusEffectBasic::AddEffectPower(ACorePlayerState* Instigator, float Powe
 	if (CanRefreshStatus(Instigator, Power))
 	{
 		RefreshCounter++;
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, RefreshCounter, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBase, RefreshCounter, this);
 
 		if (InstigatorUpdateRule == EBasicStatusEffectInstigatorRule::Refresh && StatusEffectType != EBasicStatusEffectType::Cumulative)
 		{
@@ -790,7 +886,7 @@ void UStatusEffectBasic::AddEffectPower(ACorePlayerState* Instigator, float Powe
 
 	if (CachedCurrentPower != CurrentPower)
 	{
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
 	}
 }
 
@@ -834,7 +930,7 @@ void UStatusEffectBasic::Tick(float DeltaTime)
 
 	if (CachedCurrentPower != CurrentPower)
 	{
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
 	}
 }
 
@@ -868,6 +964,11 @@ void UStatusEffectBasic::OnRep_StatusTime()
 
 void UStatusEffectBasic::OnRep_CurrentPower()
 {
+	if (IsPooled())
+	{
+		return;
+	}
+
 	OnPowerUpdate.Broadcast(this, CurrentPower);
 	K2_OnPowerChanged(CurrentPower);
 }
@@ -898,11 +999,16 @@ void UStatusEffectBasic::SetCriticalPointReached(bool bReached)
 	bCriticalPointReached = bReached;
 	OnRep_CriticalPointReached();
 
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, bCriticalPointReached, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, bCriticalPointReached, this);
 }
 
 void UStatusEffectBasic::OnRep_CriticalPointReached()
 {
+	if (IsPooled())
+	{
+		return;
+	}
+
 	OnCriticalPointReached(bCriticalPointReached);
 }
 
@@ -972,7 +1078,7 @@ void UStatusEffectStack::Initialize(UStatusComponent* StatusComponent, ACorePlay
 		CurrentStackCount = 1;
 	}
 
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectStack, CurrentStackCount, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectStack, CurrentStackCount, this);
 	OnRep_CurrentStackCount();
 
 	Super::Initialize(StatusComponent, Instigator, Power, InstigationDirection);
@@ -1013,7 +1119,7 @@ void UStatusEffectStack::OnActivated(EStatusBeginType BeginType)
 		}
 		
 		OnRep_StatusTime();
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectStack, StatusTime, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectStack, StatusTime, this);
 	}
 
 	Super::OnActivated(BeginType);
@@ -1079,6 +1185,12 @@ void UStatusEffectStack::AddEffectPower(ACorePlayerState* Instigator, float Powe
 	}
 }
 
+void UStatusEffectStack::GetStatusTime(float& StartTime, float& EndTime) const
+{
+	StartTime = StatusTime.X;
+	EndTime = StatusTime.Y;
+}
+
 void UStatusEffectStack::OnRep_StatusTime()
 {
 	OnStatusTimeUpdate.Broadcast(this, StatusTime.X, StatusTime.Y);
@@ -1086,6 +1198,11 @@ void UStatusEffectStack::OnRep_StatusTime()
 
 void UStatusEffectStack::OnRep_CurrentStackCount()
 {
+	if (IsPooled())
+	{
+		return;
+	}
+
 	OnStackCountUpdate.Broadcast(this, CurrentStackCount);
 	K2_OnPowerChanged(StackDuration);
 }
@@ -1105,5 +1222,5 @@ void UStatusEffectStack::OnStackExpired()
 	}
 
 	OnRep_CurrentStackCount();
-	MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectStack, CurrentStackCount, this);
+	MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectStack, CurrentStackCount, this);
 }
\ No newline at end of file
@@ -45,7 +45,7 @@ void UStatusEffectShield::ProcessDamage(UStatusComponent* Component, float& Dama
 
 	if (CachedCurrentPower != CurrentPower)
 	{
-		MARK_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
+		MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(UStatusEffectBasic, CurrentPower, this);
 	}
 
 	OnRep_CurrentPower();
@@ -73,5 +73,5 @@ void UStatusEffectShield::Tick(float DeltaTime)
 UStatusEffectShieldDamageLogModifier::UStatusEffectShieldDamageLogModifier(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	InstigatorName = LOCTABLE("/Game/Localization/DamageLogStringTable.DamageLogStringTable", "Modification_Shield");
+	InstigatorNameTableKey = TEXT("Modification_Shield");
 }
\ No newline at end of file
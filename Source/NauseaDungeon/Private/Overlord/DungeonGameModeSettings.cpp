@@ -5,6 +5,7 @@
 #include "System/CoreSingleton.h"
 #include "Overlord/DungeonGameMode.h"
 #include "Character/DungeonCharacter.h"
+#include "Curves/CurveBase.h"
 
 UDungeonGameModeSettings::UDungeonGameModeSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -32,21 +33,113 @@ int32 UDungeonGameModeSettings::CalculateStartingTrapCoinAmount(ADungeonGameMode
 	return GameMode->ProcessStartingTrapCoinAmount(StartingTrapCoinAmount);
 }
 
+FWaveSchedule FWaveSchedule::InvalidSchedule = FWaveSchedule();
+
 UDungeonWaveSetup::UDungeonWaveSetup(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 
 }
 
+#if WITH_EDITOR
+void UDungeonWaveSetup::PostLoad()
+{
+	Super::PostLoad();
+
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return;
+	}
+
+	//The saved bake may predate edits to curves it was built from. Cooked builds keep the table baked at cook time.
+	for (const FWaveModifierEntry& ModifierEntry : ModifierList)
+	{
+		if (UWaveModifier* Modifier = ModifierEntry.GetModifier())
+		{
+			Modifier->ConditionalPostLoad();
+		}
+
+		if (UWaveConfiguration* Configuration = ModifierEntry.GetConfiguration())
+		{
+			Configuration->ConditionalPostLoad();
+		}
+	}
+
+	if (DefaultWaveConfiguration)
+	{
+		DefaultWaveConfiguration->ConditionalPostLoad();
+	}
+
+	BakeWaveSchedule();
+
+	if (!OnObjectPropertyChangedHandle.IsValid())
+	{
+		OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UDungeonWaveSetup::OnObjectPropertyChanged);
+	}
+}
+
+void UDungeonWaveSetup::BeginDestroy()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+	OnObjectPropertyChangedHandle.Reset();
+
+	Super::BeginDestroy();
+}
+
+void UDungeonWaveSetup::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	if (!Object || Object == this)
+	{
+		return;
+	}
+
+	//Curves are shared between setups and configurations, so any curve edit is treated as affecting us. Waves are rebuilt on demand until the next save rebakes them.
+	if (Object->IsIn(this) || Object->IsA<UCurveBase>())
+	{
+		InvalidateWaveSchedule();
+	}
+}
+
+void UDungeonWaveSetup::PreSave(const class ITargetPlatform* TargetPlatform)
+{
+	Super::PreSave(TargetPlatform);
+
+	//Bake on every save (not just cook) so that the schedule table is always available to diff between balance changes.
+	BakeWaveSchedule();
+}
+
+void UDungeonWaveSetup::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	InvalidateWaveSchedule();
+}
+#endif //WITH_EDITOR
+
 TArray<UWaveConfiguration*> UDungeonWaveSetup::GetWaveConfiguration(int64 WaveNumber) const
 {
-	bool bIsOverrideWave = false;
-	int32 OverridePriority = INDEX_NONE;
-	UWaveConfiguration* BaseConfiguration = DefaultWaveConfiguration;
+	TArray<int32> ConfigurationIndexList;
+	GetWaveConfigurationIndexList(WaveNumber, ConfigurationIndexList);
+
 	TArray<UWaveConfiguration*> Result;
+	Result.Reserve(ConfigurationIndexList.Num());
 
-	for (const FWaveModifierEntry& Entry : ModifierList)
+	for (int32 ConfigurationIndex : ConfigurationIndexList)
+	{
+		Result.Add(GetConfigurationByIndex(ConfigurationIndex));
+	}
+
+	return Result;
+}
+
+void UDungeonWaveSetup::GetWaveConfigurationIndexList(int64 WaveNumber, TArray<int32>& ConfigurationIndexList) const
+{
+	int32 OverridePriority = INDEX_NONE;
+	int32 BaseConfigurationIndex = 0;
+
+	for (int32 EntryIndex = 0; EntryIndex < ModifierList.Num(); EntryIndex++)
 	{
+		const FWaveModifierEntry& Entry = ModifierList[EntryIndex];
 		const UWaveModifier* Modifier = Entry.GetModifier();
 
 		if (!Modifier || !Modifier->AppliesToWave(WaveNumber))
@@ -59,22 +152,21 @@ TArray<UWaveConfiguration*> UDungeonWaveSetup::GetWaveConfiguration(int64 WaveNu
 			continue;
 		}
 
-		UWaveConfiguration* Configuration = Entry.GetConfiguration();
-		if (!Configuration)
+		if (!Entry.GetConfiguration())
 		{
 			continue;
 		}
 
-		BaseConfiguration = Configuration;
-		bIsOverrideWave = true;
+		BaseConfigurationIndex = EntryIndex + 1;
 		OverridePriority = Modifier->GetModifierPriority();
 	}
 
-	ensure(BaseConfiguration);
-	Result.Add(BaseConfiguration);
+	ensure(GetConfigurationByIndex(BaseConfigurationIndex));
+	ConfigurationIndexList.Add(BaseConfigurationIndex);
 
-	for (const FWaveModifierEntry& Entry : ModifierList)
+	for (int32 EntryIndex = 0; EntryIndex < ModifierList.Num(); EntryIndex++)
 	{
+		const FWaveModifierEntry& Entry = ModifierList[EntryIndex];
 		const UWaveModifier* Modifier = Entry.GetModifier();
 
 		if (!Modifier || !Modifier->AppliesToWave(WaveNumber))
@@ -87,31 +179,131 @@ TArray<UWaveConfiguration*> UDungeonWaveSetup::GetWaveConfiguration(int64 WaveNu
 			continue;
 		}
 		
-		UWaveConfiguration* Configuration = Entry.GetConfiguration();
+		if (!Entry.GetConfiguration())
+		{
+			continue;
+		}
+
+		ConfigurationIndexList.Add(EntryIndex + 1);
+	}
+}
+
+UWaveConfiguration* UDungeonWaveSetup::GetConfigurationByIndex(int32 ConfigurationIndex) const
+{
+	if (ConfigurationIndex == 0)
+	{
+		return DefaultWaveConfiguration;
+	}
+
+	return ModifierList.IsValidIndex(ConfigurationIndex - 1) ? ModifierList[ConfigurationIndex - 1].GetConfiguration() : nullptr;
+}
+
+FWaveSchedule UDungeonWaveSetup::BuildWaveSchedule(int64 WaveNumber) const
+{
+	FWaveSchedule Schedule;
+	Schedule.WaveNumber = WaveNumber;
+
+	TArray<int32> ConfigurationIndexList;
+	GetWaveConfigurationIndexList(WaveNumber, ConfigurationIndexList);
+	Schedule.ConfigurationScheduleList.Reserve(ConfigurationIndexList.Num());
+
+	for (int32 ConfigurationIndex : ConfigurationIndexList)
+	{
+		const UWaveConfiguration* Configuration = GetConfigurationByIndex(ConfigurationIndex);
+
 		if (!Configuration)
 		{
 			continue;
 		}
 
-		Result.Add(Configuration);
+		const FWaveConfigurationSchedule& ConfigurationSchedule = Schedule.ConfigurationScheduleList.Add_GetRef(Configuration->MakeSchedule(WaveNumber, const_cast<UDungeonWaveSetup*>(this), ConfigurationIndex));
+		Schedule.TotalSpawnCount += ConfigurationSchedule.SpawnCount;
 	}
 
-	return Result;
+	return Schedule;
+}
+
+void UDungeonWaveSetup::BakeWaveSchedule()
+{
+	InvalidateWaveSchedule();
+
+	//Endless setups cannot be fully baked, they rely entirely on the runtime fallback.
+	if (LastWaveNumber <= 0)
+	{
+		return;
+	}
+
+	BakedWaveScheduleList.Reserve(LastWaveNumber + 1);
+
+	for (int64 WaveNumber = 0; WaveNumber <= LastWaveNumber; WaveNumber++)
+	{
+		BakedWaveScheduleList.Add(BuildWaveSchedule(WaveNumber));
+	}
+}
+
+void UDungeonWaveSetup::InvalidateWaveSchedule()
+{
+	BakedWaveScheduleList.Reset();
+	RuntimeWaveScheduleMap.Reset();
+}
+
+const FWaveSchedule& UDungeonWaveSetup::GetWaveSchedule(int32 WaveNumber)
+{
+	if (WaveNumber < 0)
+	{
+		return FWaveSchedule::InvalidSchedule;
+	}
+
+	if (BakedWaveScheduleList.IsValidIndex(WaveNumber) && BakedWaveScheduleList[WaveNumber].WaveNumber == WaveNumber)
+	{
+		return BakedWaveScheduleList[WaveNumber];
+	}
+
+	if (const FWaveSchedule* RuntimeSchedule = RuntimeWaveScheduleMap.Find(WaveNumber))
+	{
+		return *RuntimeSchedule;
+	}
+
+	return RuntimeWaveScheduleMap.Add(WaveNumber, BuildWaveSchedule(WaveNumber));
+}
+
+FString UDungeonWaveSetup::DescribeWaveSchedule() const
+{
+	FString Description;
+
+	for (const FWaveSchedule& Schedule : BakedWaveScheduleList)
+	{
+		for (const FWaveConfigurationSchedule& ConfigurationSchedule : Schedule.ConfigurationScheduleList)
+		{
+			const UWaveConfiguration* Configuration = GetConfigurationByIndex(ConfigurationSchedule.ConfigurationIndex);
+			Description += FString::Printf(TEXT("Wave %lld | %s | Count: %d Offset: %d Interval: %d Batch: %d\n"), Schedule.WaveNumber, *GetNameSafe(Configuration),
+				ConfigurationSchedule.SpawnCount, ConfigurationSchedule.TimeOffset, ConfigurationSchedule.TimeInterval, ConfigurationSchedule.SpawnBatchAmount);
+		}
+	}
+
+	return Description;
 }
 
 int64 UDungeonWaveSetup::InitializeWaveSetup(int64 WaveNumber)
 {
 	TotalExpectedSpawnCount = 0;
-	TArray<UWaveConfiguration*> WaveConfiguration = GetWaveConfiguration(WaveNumber);
+	const FWaveSchedule& Schedule = GetWaveSchedule(int32(FMath::Clamp<int64>(WaveNumber, -1, MAX_int32)));
 
-	if (WaveConfiguration.Num() == 0)
+	if (Schedule.ConfigurationScheduleList.Num() == 0)
 	{
 		return -1;
 	}
 
-	for (UWaveConfiguration* Wave : WaveConfiguration)
+	for (const FWaveConfigurationSchedule& ConfigurationSchedule : Schedule.ConfigurationScheduleList)
 	{
-		TotalExpectedSpawnCount += Wave->InitializeForWave(WaveNumber, this);
+		UWaveConfiguration* Wave = GetConfigurationByIndex(ConfigurationSchedule.ConfigurationIndex);
+
+		if (!Wave)
+		{
+			continue;
+		}
+
+		TotalExpectedSpawnCount += Wave->InitializeFromSchedule(WaveNumber, ConfigurationSchedule);
 	}
 
 	InitializedWave = WaveNumber;
@@ -125,16 +317,19 @@ bool UDungeonWaveSetup::StartWave(int64 WaveNumber)
 		return false;
 	}
 
-	TArray<UWaveConfiguration*> WaveConfiguration = GetWaveConfiguration(WaveNumber);
+	const FWaveSchedule& Schedule = GetWaveSchedule(int32(FMath::Clamp<int64>(WaveNumber, -1, MAX_int32)));
 	
-	if (WaveConfiguration.Num() == 0)
+	if (Schedule.ConfigurationScheduleList.Num() == 0)
 	{
 		return false;
 	}
 
-	for (UWaveConfiguration* Wave : WaveConfiguration)
+	for (const FWaveConfigurationSchedule& ConfigurationSchedule : Schedule.ConfigurationScheduleList)
 	{
-		Wave->StartSpawning();
+		if (UWaveConfiguration* Wave = GetConfigurationByIndex(ConfigurationSchedule.ConfigurationIndex))
+		{
+			Wave->StartSpawning();
+		}
 	}
 
 	return true;
@@ -267,6 +462,12 @@ UDungeonWaveSetup* UDungeonWaveSetup::CreateWaveSetup(UObject* WorldContextObjec
 		Setup->LastWaveNumber = LastWaveNumberOverride;
 	}
 
+	//Any schedule baked into the setup class no longer describes this setup.
+	if (bClearSetupClassModifiers || AdditionalModifiers.Num() != 0 || DefaultWaveConfigurationOverride || DefaultWaveSizeScalingOverride || DefaultWaveRateScalingOverride || LastWaveNumberOverride != INDEX_NONE)
+	{
+		Setup->InvalidateWaveSchedule();
+	}
+
 	return Setup;
 }
 
@@ -282,16 +483,21 @@ UWaveConfiguration::UWaveConfiguration(const FObjectInitializer& ObjectInitializ
 }
 
 int32 UWaveConfiguration::InitializeForWave(int64 WaveNumber, UDungeonWaveSetup* Setup)
+{
+	return InitializeFromSchedule(WaveNumber, MakeSchedule(WaveNumber, Setup));
+}
+
+int32 UWaveConfiguration::InitializeFromSchedule(int64 WaveNumber, const FWaveConfigurationSchedule& Schedule)
 {
 	CleanUp();
 	InitializedWaveNumber = WaveNumber;
 	NumberSpawned = 0;
 	RequestedSpawnCount = 0;
 
-	TotalSpawnCount = GetSpawnCount(WaveNumber, Setup);
-	CurrentSpawnTimeOffset = GetTimeOffset(WaveNumber, Setup);
-	CurrentSpawnInterval = GetTimeInterval(WaveNumber, Setup);
-	CurrentSpawnBatchAmount = GetSpawnBatchAmount(WaveNumber, Setup);
+	TotalSpawnCount = Schedule.SpawnCount;
+	CurrentSpawnTimeOffset = Schedule.TimeOffset;
+	CurrentSpawnInterval = Schedule.TimeInterval;
+	CurrentSpawnBatchAmount = Schedule.SpawnBatchAmount;
 
 	for (UWaveSpawnGroup* Group : SpawnWaveGroups)
 	{
@@ -306,6 +512,11 @@ int32 UWaveConfiguration::InitializeForWave(int64 WaveNumber, UDungeonWaveSetup*
 	return TotalSpawnCount;
 }
 
+FWaveConfigurationSchedule UWaveConfiguration::MakeSchedule(int64 WaveNumber, UDungeonWaveSetup* Setup, int32 ConfigurationIndex) const
+{
+	return FWaveConfigurationSchedule(ConfigurationIndex, GetSpawnCount(WaveNumber, Setup), GetTimeOffset(WaveNumber, Setup), GetTimeInterval(WaveNumber, Setup), GetSpawnBatchAmount(WaveNumber, Setup));
+}
+
 void UWaveConfiguration::CleanUp()
 {
 	StopSpawning();
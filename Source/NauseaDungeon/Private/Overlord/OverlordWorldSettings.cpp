@@ -3,6 +3,7 @@
 
 #include "Overlord/OverlordWorldSettings.h"
 #include "Overlord/PlacementActor.h"
+#include "Overlord/TrapActivationScheduler.h"
 
 AOverlordWorldSettings::AOverlordWorldSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -41,4 +42,41 @@ void AOverlordWorldSettings::BuildAllGridData()
 			Itr->GetParentPlacementActor()->PushPlacementData(Itr->GetPlacementGrid());
 		}
 	}
+}
+
+FPlacementSpatialIndex* AOverlordWorldSettings::FindPlacementSpatialIndex(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	AOverlordWorldSettings* OverlordWorldSettings = Cast<AOverlordWorldSettings>(World->GetWorldSettings());
+	return OverlordWorldSettings ? &OverlordWorldSettings->GetPlacementSpatialIndex() : nullptr;
+}
+
+bool AOverlordWorldSettings::IsPlacementLocationOccupied(const UObject* WorldContextObject, const FVector& WorldLocation)
+{
+	const FPlacementSpatialIndex* SpatialIndex = FindPlacementSpatialIndex(WorldContextObject);
+
+	if (!SpatialIndex)
+	{
+		return false;
+	}
+
+	FPlacementCoordinates Coordinates;
+	const APlacementActor* PlacementActor = SpatialIndex->FindPlacementActor(WorldLocation, Coordinates);
+	return PlacementActor && PlacementActor->GetPlacementGrid().Get(Coordinates).IsOccupied();
+}
+
+UTrapActivationScheduler* AOverlordWorldSettings::GetTrapActivationScheduler()
+{
+	if (!TrapActivationScheduler)
+	{
+		TrapActivationScheduler = NewObject<UTrapActivationScheduler>(this);
+	}
+
+	return TrapActivationScheduler;
 }
\ No newline at end of file
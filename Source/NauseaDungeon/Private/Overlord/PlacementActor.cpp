@@ -2,11 +2,13 @@
 
 
 #include "Overlord/PlacementActor.h"
+#include "Overlord/OverlordWorldSettings.h"
 #include "Components/ArrowComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "UObject/ConstructorHelpers.h"
 #include "DrawDebugHelpers.h"
+#include "NauseaNetDefines.h"
 
 UPlacementMarkerComponent::UPlacementMarkerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -78,6 +80,11 @@ APlacementActor::APlacementActor(const FObjectInitializer& ObjectInitializer)
 
 	SetActorHiddenInGame(true);
 
+	//Placement actors are level placed and only change when placement data or occupancy is pushed. See PushPlacementData and NotifyPlacementOccupancyChanged.
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	NetDormancy = DORM_Initial;
+
 	static ConstructorHelpers::FClassFinder<UPlacementMarkerComponent> PlacementMarkerComponentClassFinder(TEXT("/Game/Blueprint/Traps/Placement/BP_PlacementMarkerComponent"));
 	PlacementMarkerClass = PlacementMarkerComponentClassFinder.Class;
 
@@ -88,17 +95,26 @@ APlacementActor::APlacementActor(const FObjectInitializer& ObjectInitializer)
 void APlacementActor::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
+
+	PlacementOccupancy.SetOwningPlacementActor(this);
 }
 
 void APlacementActor::BeginPlay()
 {
 	Super::BeginPlay();
 
+	CachedParentmostPlacementActor = GetParentmostPlacementActor();
+
 	if (GetParentPlacementActor())
 	{
 		return;
 	}
 
+	if (FPlacementSpatialIndex* SpatialIndex = AOverlordWorldSettings::FindPlacementSpatialIndex(this))
+	{
+		SpatialIndex->Add(this);
+	}
+
 	return;
 	const FVector RightVector = GetActorRightVector();
 	const FVector UpVector = GetActorUpVector();
@@ -156,6 +172,25 @@ void APlacementActor::BeginPlay()
 	}
 }
 
+void APlacementActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (FPlacementSpatialIndex* SpatialIndex = AOverlordWorldSettings::FindPlacementSpatialIndex(this))
+	{
+		SpatialIndex->Remove(this);
+	}
+
+	CachedParentmostPlacementActor = nullptr;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void APlacementActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(APlacementActor, PlacementOccupancy, PushReplicationParams::Default);
+}
+
 #if WITH_EDITOR
 void APlacementActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -219,6 +254,11 @@ FPlacementGrid& APlacementActor::GetParentmostPlacementGrid()
 
 APlacementActor* APlacementActor::GetParentmostPlacementActor() const
 {
+	if (CachedParentmostPlacementActor.IsValid())
+	{
+		return CachedParentmostPlacementActor.Get();
+	}
+
 	const APlacementActor* CurrentParent = this;
 	while (CurrentParent && CurrentParent->GetParentPlacementActor())
 	{
@@ -239,6 +279,68 @@ void APlacementActor::PushPlacementData(const FPlacementGrid& InGridData)
 	ensure(PlacementGrid.Append(InGridData));
 }
 
+bool APlacementActor::SetPlacementOccupant(int32 X, int32 Y, UObject* Occupant)
+{
+	if (GetParentPlacementActor())
+	{
+		return GetParentmostPlacementActor()->SetPlacementOccupant(X, Y, Occupant);
+	}
+
+	if (!PlacementGrid.SetOccupant(X, Y, Occupant))
+	{
+		return false;
+	}
+
+	if (GetLocalRole() == ROLE_Authority && PlacementOccupancy.SetOccupied(X, Y, Occupant != nullptr))
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(APlacementActor, PlacementOccupancy, this);
+	}
+
+	return true;
+}
+
+bool APlacementActor::ClearPlacementOccupantByHandle(FPlacementHandle Handle)
+{
+	if (GetParentPlacementActor())
+	{
+		return GetParentmostPlacementActor()->ClearPlacementOccupantByHandle(Handle);
+	}
+
+	const FPlacementCoordinates* Coordinates = PlacementGrid.FindCoordinatesByHandle(Handle);
+
+	if (!Coordinates)
+	{
+		return false;
+	}
+
+	return SetPlacementOccupant(Coordinates->GetX(), Coordinates->GetY(), nullptr);
+}
+
+void APlacementActor::NotifyPlacementOccupancyChanged()
+{
+	if (GetParentPlacementActor())
+	{
+		GetParentmostPlacementActor()->NotifyPlacementOccupancyChanged();
+		return;
+	}
+
+	if (GetLocalRole() == ROLE_Authority && GetIsReplicated())
+	{
+		FlushNetDormancy();
+	}
+}
+
+void APlacementActor::OnReceivedOccupancyUpdate(const FPlacementOccupancyRow& OccupancyRow)
+{
+	const int32 RowIndex = OccupancyRow.GetRowIndex();
+	const int32 SizeX = PlacementGrid.GetSizeX();
+
+	for (int32 IndexX = 0; IndexX < SizeX; IndexX++)
+	{
+		PlacementGrid.SetReplicatedOccupied(IndexX, RowIndex, OccupancyRow.IsOccupied(IndexX));
+	}
+}
+
 #if WITH_EDITOR
 void APlacementActor::OnPlacementPreviewUpdate()
 {
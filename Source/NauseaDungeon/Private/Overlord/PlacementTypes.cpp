@@ -2,6 +2,7 @@
 
 
 #include "Overlord/PlacementTypes.h"
+#include "Overlord/PlacementActor.h"
 #include "DrawDebugHelpers.h"
 
 static TAutoConsoleVariable<int32> CVarDebugDrawGridPlacement(
@@ -9,6 +10,16 @@ static TAutoConsoleVariable<int32> CVarDebugDrawGridPlacement(
 	0,
 	TEXT("Enable drawing of grid placement calculation and adjustments."));
 
+DECLARE_STATS_GROUP(TEXT("PlacementGrid"), STATGROUP_PlacementGrid, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Is Valid Placement"), STAT_PlacementGridIsValidPlacement, STATGROUP_PlacementGrid);
+DECLARE_CYCLE_STAT(TEXT("Adjust Coordinates To Valid Point"), STAT_PlacementGridAdjustCoordinatesToValidPoint, STATGROUP_PlacementGrid);
+DECLARE_CYCLE_STAT(TEXT("Get Placement Coordinates For Size"), STAT_PlacementGridGetPlacementCoordinatesForSize, STATGROUP_PlacementGrid);
+DECLARE_CYCLE_STAT(TEXT("Adjust Anchor To Valid Point"), STAT_PlacementGridAdjustAnchorToValidPoint, STATGROUP_PlacementGrid);
+DECLARE_CYCLE_STAT(TEXT("Build Availability Mask"), STAT_PlacementGridBuildAvailabilityMask, STATGROUP_PlacementGrid);
+DECLARE_CYCLE_STAT(TEXT("Find Nearest Valid Placement"), STAT_PlacementGridFindNearestValidPlacement, STATGROUP_PlacementGrid);
+DECLARE_CYCLE_STAT(TEXT("Spatial Index Find Placement Actor"), STAT_PlacementSpatialIndexFindPlacementActor, STATGROUP_PlacementGrid);
+
 uint64 FPlacementHandle::HandleIDCounter = MAX_uint64;
 FPlacementPoint FPlacementPoint::InvalidPoint = FPlacementPoint();
 
@@ -67,6 +78,8 @@ void FPlacementGrid::AddPointFromWorldPosition(const FVector& WorldPosition)
 
 bool FPlacementGrid::AdjustCoordinatesToValidPoint(UWorld* World, FPlacementCoordinates& Coordinates, const TArray<EPlacementDirection>& BiasOrder, bool bMustBeEmpty) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_PlacementGridAdjustCoordinatesToValidPoint);
+
 	if (IsDebugDrawPlacementEnabled())
 	{
 		DrawDebugBox(World, GetCenteredWorldPosition(Coordinates), FVector(12.f), FColor::Green, false, 0.1f, 0, 2.f);
@@ -206,6 +219,8 @@ inline EPlacementDirection GetHorizontalBias(const TArray<EPlacementDirection>&
 
 FPlacementCoordinates FPlacementGrid::GetPlacementCoordinatesForSizeNeo(UWorld* World, const FVector& WorldPosition, int32 SizeX, int32 SizeY, bool bMustBeEmpty) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_PlacementGridGetPlacementCoordinatesForSize);
+
 	SetDebugDrawPlacementEnabled(IsDebugDrawPlacementCVarSet());
 
 	TArray<EPlacementDirection> BiasOrder;
@@ -256,30 +271,19 @@ FPlacementCoordinates FPlacementGrid::GetPlacementCoordinatesForSizeNeo(UWorld*
 		DrawDebugBox(World, GetCenteredWorldPosition(AdjustedStartingLocation), FVector(28.f), FColor::Silver, false, 0.1f, 0, 4.f);
 	}
 
-	bool bFoundValidPlacement = IsValidPlacement(AdjustedStartingLocation, SizeX, SizeY, bMustBeEmpty);
-	FPlacementCoordinates Adjustment;
-	int32 RemainingAttemptCount = 8;
-	while (!bFoundValidPlacement && RemainingAttemptCount > 0)
+	if (IsValidPlacement(AdjustedStartingLocation, SizeX, SizeY, bMustBeEmpty))
 	{
-		Adjustment = GetAdjustmentDirection(World, AdjustedStartingLocation, SizeX, SizeY, bMustBeEmpty);
-
-		if (!Adjustment.IsValid())
-		{
-			return FPlacementCoordinates();
-		}
-
-		AdjustedStartingLocation += Adjustment;
-
-		bFoundValidPlacement = IsValidPlacement(AdjustedStartingLocation, SizeX, SizeY, bMustBeEmpty);
-		RemainingAttemptCount--;
+		return AdjustedStartingLocation;
 	}
 
-	if (!bFoundValidPlacement)
+	//Evaluate every anchor around the starting location at once instead of stepping towards a valid one.
+	FPlacementCoordinates NearestValidPlacement;
+	if (!FindNearestValidPlacement(AdjustedStartingLocation, SizeX, SizeY, bMustBeEmpty, 8, NearestValidPlacement))
 	{
 		return FPlacementCoordinates();
 	}
 
-	return AdjustedStartingLocation;
+	return NearestValidPlacement;
 }
 
 FPlacementCoordinates FPlacementGrid::GetAdjustmentDirection(UWorld* World, FPlacementCoordinates& Coordinates, int32 SizeX, int32 SizeY, bool bMustBeEmpty) const
@@ -448,6 +452,8 @@ FPlacementCoordinates FPlacementGrid::GetAdjustmentDirection(UWorld* World, FPla
 
 bool FPlacementGrid::IsValidPlacement(const FPlacementCoordinates& Coordinates, int32 SizeX, int32 SizeY, bool bMustBeEmpty) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_PlacementGridIsValidPlacement);
+
 	if (!IsValid() || !Coordinates.IsValid())
 	{
 		return false;
@@ -467,33 +473,94 @@ bool FPlacementGrid::IsValidPlacement(const FPlacementCoordinates& Coordinates,
 		return false;
 	}
 
-	int32 IndexX;
-	int32 IndexY;
-	for (IndexY = Coordinates.GetY(); IndexY < EndY; IndexY++)
+	const FPlacementAvailabilityMask& AvailabilityMask = GetAvailabilityMask(bMustBeEmpty);
+	for (int32 IndexY = StartY; IndexY < EndY; IndexY++)
 	{
-		const TArray<FPlacementPoint>& Row = RowList[IndexY].GetRow();
-		
-		//If this row can't even contain EndX, then this placement is not possible (don't bother checking the whole array).
-		if (Row.Num() <= EndX - 1)
+		if (!AvailabilityMask.IsRangeAvailable(StartX, IndexY, SizeX))
 		{
 			return false;
 		}
+	}
 
-		for (IndexX = StartX; IndexX < EndX; IndexX++)
+	return true;
+}
+
+bool FPlacementGrid::FindNearestValidPlacement(const FPlacementCoordinates& Coordinates, int32 SizeX, int32 SizeY, bool bMustBeEmpty, int32 MaxDistance, FPlacementCoordinates& OutCoordinates) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_PlacementGridFindNearestValidPlacement);
+
+	if (!IsValid() || !Coordinates.IsValid() || SizeX <= 0 || SizeY <= 0)
+	{
+		return false;
+	}
+
+	const int32 GridSizeX = GetSizeX();
+	const int32 GridSizeY = GetSizeY();
+	const int32 MinX = FMath::Max(Coordinates.GetX() - MaxDistance, 0);
+	const int32 MaxX = FMath::Min(Coordinates.GetX() + MaxDistance, GridSizeX - SizeX);
+	const int32 MinY = FMath::Max(Coordinates.GetY() - MaxDistance, 0);
+	const int32 MaxY = FMath::Min(Coordinates.GetY() + MaxDistance, GridSizeY - SizeY);
+
+	if (MinX > MaxX || MinY > MaxY)
+	{
+		return false;
+	}
+
+	const FPlacementAvailabilityMask& AvailabilityMask = GetAvailabilityMask(bMustBeEmpty);
+	const int32 WordsPerRow = AvailabilityMask.GetWordsPerRow();
+
+	static TArray<uint64> AnchorMask;
+	AvailabilityMask.GetValidAnchors(SizeX, SizeY, MinY, MaxY, AnchorMask);
+
+	int32 BestDistanceSquared = MAX_int32;
+	int32 IndexX;
+	for (int32 IndexY = MinY; IndexY <= MaxY; IndexY++)
+	{
+		const int32 DeltaY = IndexY - Coordinates.GetY();
+		const int32 DeltaYSquared = DeltaY * DeltaY;
+
+		if (DeltaYSquared >= BestDistanceSquared)
 		{
-			const FPlacementPoint& Point = Row[IndexX];
-			if (!Point.IsValid() || (bMustBeEmpty && Point.IsOccupied()))
+			continue;
+		}
+
+		const uint64* AnchorRow = &AnchorMask[(IndexY - MinY) * WordsPerRow];
+		for (IndexX = MinX; IndexX <= MaxX; IndexX++)
+		{
+			if (!FPlacementAvailabilityMask::IsBitSet(AnchorRow, IndexX))
 			{
-				return false;
+				continue;
+			}
+
+			const int32 DeltaX = IndexX - Coordinates.GetX();
+			const int32 DistanceSquared = (DeltaX * DeltaX) + DeltaYSquared;
+			if (DistanceSquared < BestDistanceSquared)
+			{
+				BestDistanceSquared = DistanceSquared;
+				OutCoordinates = FPlacementCoordinates(IndexX, IndexY);
 			}
 		}
 	}
 
-	return true;
+	return BestDistanceSquared != MAX_int32;
+}
+
+const FPlacementAvailabilityMask& FPlacementGrid::GetAvailabilityMask(bool bMustBeEmpty) const
+{
+	FPlacementAvailabilityMask& AvailabilityMask = AvailabilityMaskList[bMustBeEmpty ? 1 : 0];
+
+	if (AvailabilityMask.IsDirty())
+	{
+		AvailabilityMask.Build(RowList, GetSizeX(), bMustBeEmpty);
+	}
+
+	return AvailabilityMask;
 }
 
 bool FPlacementGrid::AdjustAnchorToValidPoint(UWorld* World, FPlacementCoordinates& Coordinates, EPlacementAnchor AnchorType, int32 HalfSizeX, int32 HalfSizeY, bool bMustBeEmpty) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_PlacementGridAdjustAnchorToValidPoint);
+
 	FColor AnchorColorTest;
 	switch(AnchorType)
 	{
@@ -691,6 +758,62 @@ bool FPlacementGrid::CanMergeWith(const FPlacementGrid& InGrid) const
 	return true;
 }
 
+bool FPlacementGrid::GetCoordinatesAtWorldPosition(const FVector& WorldPosition, float PlaneTolerance, FPlacementCoordinates& OutCoordinates, float& OutPlaneDistance) const
+{
+	const FVector LocalPosition = RootTransform.InverseTransformPosition(WorldPosition);
+
+	if (FMath::Abs(LocalPosition.X) > PlaneTolerance)
+	{
+		return false;
+	}
+
+	const FPlacementCoordinates Coordinates = FPlacementCoordinates(FMath::FloorToInt(LocalPosition.Y / TrapGridSize), FMath::FloorToInt(LocalPosition.Z / TrapGridSize));
+
+	if (!Contains(Coordinates))
+	{
+		return false;
+	}
+
+	OutCoordinates = Coordinates;
+	OutPlaneDistance = FMath::Abs(LocalPosition.X);
+	return true;
+}
+
+FBox FPlacementGrid::GetWorldBounds() const
+{
+	const float Width = float(GetSizeX()) * TrapGridSize;
+	const float Height = float(GetSizeY()) * TrapGridSize;
+
+	FBox Bounds(ForceInit);
+	Bounds += RootTransform.TransformPosition(FVector::ZeroVector);
+	Bounds += RootTransform.TransformPosition(FVector(0.f, Width, 0.f));
+	Bounds += RootTransform.TransformPosition(FVector(0.f, 0.f, Height));
+	Bounds += RootTransform.TransformPosition(FVector(0.f, Width, Height));
+	return Bounds;
+}
+
+bool FPlacementGrid::GetRayIntersection(const FVector& RayOrigin, const FVector& RayDirection, FVector& OutWorldPosition) const
+{
+	//Grid points lie on the root transform's YZ plane and face along its X axis.
+	const FVector LocalOrigin = RootTransform.InverseTransformPosition(RayOrigin);
+	const FVector LocalDirection = RootTransform.InverseTransformVectorNoScale(RayDirection);
+
+	if (LocalOrigin.X <= 0.f || LocalDirection.X >= -KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	const FVector LocalPosition = LocalOrigin + (LocalDirection * (-LocalOrigin.X / LocalDirection.X));
+
+	if (!Contains(FMath::FloorToInt(LocalPosition.Y / TrapGridSize), FMath::FloorToInt(LocalPosition.Z / TrapGridSize)))
+	{
+		return false;
+	}
+
+	OutWorldPosition = RootTransform.TransformPosition(LocalPosition);
+	return true;
+}
+
 bool FPlacementGrid::Append(const FPlacementGrid& InGrid)
 {
 	if (!CanMergeWith(InGrid))
@@ -751,4 +874,370 @@ void FPlacementGrid::RecalculateHandleMap()
 void FPlacementGrid::Reset()
 {
 	RowList.Reset();
+	MarkAvailabilityDirty();
+}
+
+
+bool FPlacementOccupancyRow::SetOccupied(int32 X, bool bOccupied)
+{
+	if (X < 0)
+	{
+		return false;
+	}
+
+	const int32 ByteIndex = X >> 3;
+	if (!OccupancyBits.IsValidIndex(ByteIndex))
+	{
+		if (!bOccupied)
+		{
+			return false;
+		}
+
+		OccupancyBits.SetNumZeroed(ByteIndex + 1);
+	}
+
+	const uint8 Mask = 1 << (X & 7);
+	if (((OccupancyBits[ByteIndex] & Mask) != 0) == bOccupied)
+	{
+		return false;
+	}
+
+	OccupancyBits[ByteIndex] ^= Mask;
+	return true;
+}
+
+bool FPlacementOccupancyContainer::SetOccupied(int32 X, int32 Y, bool bOccupied)
+{
+	if (Y < 0)
+	{
+		return false;
+	}
+
+	FPlacementOccupancyRow* OccupancyRow = InstanceList.FindByPredicate([Y](const FPlacementOccupancyRow& Row) { return Row.GetRowIndex() == Y; });
+
+	if (!OccupancyRow)
+	{
+		if (!bOccupied)
+		{
+			return false;
+		}
+
+		OccupancyRow = &InstanceList.Add_GetRef(FPlacementOccupancyRow(Y));
+	}
+
+	if (!OccupancyRow->SetOccupied(X, bOccupied))
+	{
+		return false;
+	}
+
+	MarkItemDirty(*OccupancyRow);
+	return true;
+}
+
+void FPlacementOccupancyContainer::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+	if (!OwningPlacementActor)
+	{
+		return;
+	}
+
+	for (const int32& Index : AddedIndices)
+	{
+		OwningPlacementActor->OnReceivedOccupancyUpdate(InstanceList[Index]);
+	}
+}
+
+void FPlacementOccupancyContainer::PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize)
+{
+	if (!OwningPlacementActor)
+	{
+		return;
+	}
+
+	for (const int32& Index : ChangedIndices)
+	{
+		OwningPlacementActor->OnReceivedOccupancyUpdate(InstanceList[Index]);
+	}
 }
+
+const float FPlacementSpatialIndex::CellSize = TrapGridSize * 8.f;
+
+void FPlacementSpatialIndex::Add(APlacementActor* PlacementActor)
+{
+	if (!PlacementActor)
+	{
+		return;
+	}
+
+	Remove(PlacementActor);
+
+	const FPlacementGrid& Grid = PlacementActor->GetPlacementGrid();
+
+	if (!Grid.IsValid())
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.PlacementActor = PlacementActor;
+	Entry.Bounds = Grid.GetWorldBounds().ExpandBy(TrapGridSize * 0.5f);
+	const int32 EntryIndex = EntryList.Add(MoveTemp(Entry));
+	EntryIndexMap.Add(PlacementActor, EntryIndex);
+
+	const FBox& Bounds = EntryList[EntryIndex].Bounds;
+	const FIntPoint MinKey = GetCellKey(Bounds.Min.X, Bounds.Min.Y);
+	const FIntPoint MaxKey = GetCellKey(Bounds.Max.X, Bounds.Max.Y);
+
+	int32 KeyX;
+	for (int32 KeyY = MinKey.Y; KeyY <= MaxKey.Y; KeyY++)
+	{
+		for (KeyX = MinKey.X; KeyX <= MaxKey.X; KeyX++)
+		{
+			CellMap.FindOrAdd(FIntPoint(KeyX, KeyY)).Add(EntryIndex);
+		}
+	}
+}
+
+void FPlacementSpatialIndex::Remove(APlacementActor* PlacementActor)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryIndexMap.RemoveAndCopyValue(PlacementActor, EntryIndex))
+	{
+		return;
+	}
+
+	const FBox& Bounds = EntryList[EntryIndex].Bounds;
+	const FIntPoint MinKey = GetCellKey(Bounds.Min.X, Bounds.Min.Y);
+	const FIntPoint MaxKey = GetCellKey(Bounds.Max.X, Bounds.Max.Y);
+
+	int32 KeyX;
+	for (int32 KeyY = MinKey.Y; KeyY <= MaxKey.Y; KeyY++)
+	{
+		for (KeyX = MinKey.X; KeyX <= MaxKey.X; KeyX++)
+		{
+			const FIntPoint Key = FIntPoint(KeyX, KeyY);
+			if (TArray<int32, TInlineAllocator<4>>* Cell = CellMap.Find(Key))
+			{
+				Cell->RemoveSwap(EntryIndex);
+
+				if (Cell->Num() == 0)
+				{
+					CellMap.Remove(Key);
+				}
+			}
+		}
+	}
+
+	EntryList.RemoveAt(EntryIndex);
+}
+
+void FPlacementSpatialIndex::Reset()
+{
+	EntryList.Reset();
+	EntryIndexMap.Reset();
+	CellMap.Reset();
+}
+
+APlacementActor* FPlacementSpatialIndex::FindPlacementActor(const FVector& WorldPosition, FPlacementCoordinates& OutCoordinates, float PlaneTolerance) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_PlacementSpatialIndexFindPlacementActor);
+
+	const TArray<int32, TInlineAllocator<4>>* Cell = CellMap.Find(GetCellKey(WorldPosition.X, WorldPosition.Y));
+
+	if (!Cell)
+	{
+		return nullptr;
+	}
+
+	APlacementActor* Result = nullptr;
+	float ResultPlaneDistance = MAX_FLT;
+	FPlacementCoordinates Coordinates;
+	float PlaneDistance = 0.f;
+	for (int32 EntryIndex : *Cell)
+	{
+		const FEntry& Entry = EntryList[EntryIndex];
+
+		if (!Entry.Bounds.IsInsideOrOn(WorldPosition) || !Entry.PlacementActor.IsValid())
+		{
+			continue;
+		}
+
+		if (!Entry.PlacementActor->GetPlacementGrid().GetCoordinatesAtWorldPosition(WorldPosition, PlaneTolerance, Coordinates, PlaneDistance))
+		{
+			continue;
+		}
+
+		if (PlaneDistance < ResultPlaneDistance)
+		{
+			Result = Entry.PlacementActor.Get();
+			ResultPlaneDistance = PlaneDistance;
+			OutCoordinates = Coordinates;
+		}
+	}
+
+	return Result;
+}
+
+void FPlacementSpatialIndex::GetPlacementActorsInBox(const FBox& Box, TArray<APlacementActor*>& OutPlacementActorList) const
+{
+	const FIntPoint MinKey = GetCellKey(Box.Min.X, Box.Min.Y);
+	const FIntPoint MaxKey = GetCellKey(Box.Max.X, Box.Max.Y);
+
+	int32 KeyX;
+	for (int32 KeyY = MinKey.Y; KeyY <= MaxKey.Y; KeyY++)
+	{
+		for (KeyX = MinKey.X; KeyX <= MaxKey.X; KeyX++)
+		{
+			const TArray<int32, TInlineAllocator<4>>* Cell = CellMap.Find(FIntPoint(KeyX, KeyY));
+
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (int32 EntryIndex : *Cell)
+			{
+				const FEntry& Entry = EntryList[EntryIndex];
+
+				if (!Entry.PlacementActor.IsValid() || !Entry.Bounds.Intersect(Box))
+				{
+					continue;
+				}
+
+				OutPlacementActorList.AddUnique(Entry.PlacementActor.Get());
+			}
+		}
+	}
+}
+
+void FPlacementAvailabilityMask::Build(const TArray<FPlacementGridRow>& RowList, int32 InSizeX, bool bMustBeEmpty)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PlacementGridBuildAvailabilityMask);
+
+	SizeX = InSizeX;
+	SizeY = RowList.Num();
+	WordsPerRow = FMath::Max((SizeX + 63) >> 6, 1);
+
+	Bits.Reset(SizeY * WordsPerRow);
+	Bits.SetNumZeroed(SizeY * WordsPerRow);
+
+	int32 IndexX;
+	for (int32 IndexY = 0; IndexY < SizeY; IndexY++)
+	{
+		const TArray<FPlacementPoint>& Row = RowList[IndexY].GetRow();
+		uint64* RowBits = &Bits[IndexY * WordsPerRow];
+		const int32 RowSize = FMath::Min(Row.Num(), SizeX);
+
+		for (IndexX = 0; IndexX < RowSize; IndexX++)
+		{
+			const FPlacementPoint& Point = Row[IndexX];
+			if (Point.IsValid() && (!bMustBeEmpty || !Point.IsOccupied()))
+			{
+				RowBits[IndexX >> 6] |= uint64(1) << (IndexX & 63);
+			}
+		}
+	}
+
+	bDirty = false;
+}
+
+bool FPlacementAvailabilityMask::IsRangeAvailable(int32 StartX, int32 Y, int32 Count) const
+{
+	if (Y < 0 || Y >= SizeY || StartX < 0 || Count <= 0 || StartX + Count > SizeX)
+	{
+		return false;
+	}
+
+	const uint64* RowBits = &Bits[Y * WordsPerRow];
+	int32 X = StartX;
+	const int32 EndX = StartX + Count;
+	while (X < EndX)
+	{
+		const int32 BitIndex = X & 63;
+		const int32 BitCount = FMath::Min(64 - BitIndex, EndX - X);
+		const uint64 RangeMask = (BitCount == 64 ? ~uint64(0) : ((uint64(1) << BitCount) - 1)) << BitIndex;
+
+		if ((RowBits[X >> 6] & RangeMask) != RangeMask)
+		{
+			return false;
+		}
+
+		X += BitCount;
+	}
+
+	return true;
+}
+
+void FPlacementAvailabilityMask::GetValidAnchors(int32 FootprintSizeX, int32 FootprintSizeY, int32 MinY, int32 MaxY, TArray<uint64>& OutAnchorMask) const
+{
+	const int32 AnchorRowCount = MaxY - MinY + 1;
+
+	if (AnchorRowCount <= 0 || FootprintSizeX <= 0 || FootprintSizeY <= 0)
+	{
+		OutAnchorMask.Reset();
+		return;
+	}
+
+	//Footprints starting in the last anchor row reach FootprintSizeY - 1 rows past it.
+	const int32 SourceRowCount = AnchorRowCount + FootprintSizeY - 1;
+	OutAnchorMask.Reset(SourceRowCount * WordsPerRow);
+	OutAnchorMask.SetNumZeroed(SourceRowCount * WordsPerRow);
+
+	int32 Covered, Shift;
+	for (int32 RowOffset = 0; RowOffset < SourceRowCount; RowOffset++)
+	{
+		const int32 IndexY = MinY + RowOffset;
+		if (IndexY < 0 || IndexY >= SizeY)
+		{
+			continue;
+		}
+
+		uint64* AnchorRow = &OutAnchorMask[RowOffset * WordsPerRow];
+		FMemory::Memcpy(AnchorRow, &Bits[IndexY * WordsPerRow], WordsPerRow * sizeof(uint64));
+
+		//Erode horizontally by doubling the covered width each pass. Bit X ends up set only if X through X + FootprintSizeX - 1 are available.
+		for (Covered = 1; Covered < FootprintSizeX; Covered += Shift)
+		{
+			Shift = FMath::Min(Covered, FootprintSizeX - Covered);
+			AndShiftedRight(AnchorRow, AnchorRow, WordsPerRow, Shift);
+		}
+	}
+
+	//Erode vertically the same way, a whole row of anchors at a time.
+	int32 WordIndex;
+	for (Covered = 1; Covered < FootprintSizeY; Covered += Shift)
+	{
+		Shift = FMath::Min(Covered, FootprintSizeY - Covered);
+		for (int32 RowOffset = 0; RowOffset + Shift < SourceRowCount; RowOffset++)
+		{
+			uint64* AnchorRow = &OutAnchorMask[RowOffset * WordsPerRow];
+			const uint64* OtherRow = &OutAnchorMask[(RowOffset + Shift) * WordsPerRow];
+			for (WordIndex = 0; WordIndex < WordsPerRow; WordIndex++)
+			{
+				AnchorRow[WordIndex] &= OtherRow[WordIndex];
+			}
+		}
+	}
+
+	OutAnchorMask.SetNum(AnchorRowCount * WordsPerRow, false);
+}
+
+void FPlacementAvailabilityMask::AndShiftedRight(uint64* Destination, const uint64* Source, int32 WordCount, int32 Shift)
+{
+	const int32 WordShift = Shift >> 6;
+	const int32 BitShift = Shift & 63;
+
+	//Ascending order only ever reads words at or after the one being written, so this is safe to do in place.
+	for (int32 WordIndex = 0; WordIndex < WordCount; WordIndex++)
+	{
+		const int32 SourceIndex = WordIndex + WordShift;
+		uint64 Value = SourceIndex < WordCount ? (Source[SourceIndex] >> BitShift) : 0;
+
+		if (BitShift != 0 && SourceIndex + 1 < WordCount)
+		{
+			Value |= Source[SourceIndex + 1] << (64 - BitShift);
+		}
+
+		Destination[WordIndex] &= Value;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Overlord/TrapActivationScheduler.h"
+#include "GameFramework/Pawn.h"
+#include "EngineUtils.h"
+#include "Overlord/OverlordWorldSettings.h"
+#include "Overlord/TrapBase.h"
+
+static TAutoConsoleVariable<int32> CVarTrapActivationMaxPerFrame(
+	TEXT("Nausea.TrapActivationMaxPerFrame"),
+	0,
+	TEXT("Maximum number of traps activated by the trap activation scheduler in a single frame. Remaining due traps are deferred to the next frame. 0 is unlimited."));
+
+DECLARE_CYCLE_STAT(TEXT("Activate Due Traps"), STAT_TrapActivationSchedulerActivateDueTraps, STATGROUP_TrapActivationScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Activated Traps"), STAT_TrapActivationSchedulerActivatedTraps, STATGROUP_TrapActivationScheduler);
+
+const float UTrapActivationScheduler::SlotDuration = 1.f / 30.f;
+const int32 UTrapActivationScheduler::WheelSize = 256;
+
+UTrapActivationScheduler::UTrapActivationScheduler(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Wheel.SetNum(WheelSize);
+}
+
+UTrapActivationScheduler* UTrapActivationScheduler::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	AOverlordWorldSettings* OverlordWorldSettings = Cast<AOverlordWorldSettings>(World->GetWorldSettings());
+	return OverlordWorldSettings ? OverlordWorldSettings->GetTrapActivationScheduler() : nullptr;
+}
+
+void UTrapActivationScheduler::RegisterTrap(ATrapBase* Trap)
+{
+	if (!Trap || EntryIndexMap.Contains(Trap) || !GetWorld())
+	{
+		return;
+	}
+
+	//Nothing ticks the wheel while it is empty, so catch it up to the world clock before scheduling against it.
+	if (EntryList.Num() == 0)
+	{
+		CurrentTick = GetTickForTime(GetWorld()->GetTimeSeconds());
+	}
+
+	FTrapActivationEntry Entry;
+	Entry.Trap = Trap;
+	Entry.TrapKey = Trap;
+	Entry.TrapClass = Trap->GetClass();
+	const int32 EntryIndex = EntryList.Add(MoveTemp(Entry));
+	EntryIndexMap.Add(Trap, EntryIndex);
+
+	Schedule(EntryIndex, Trap->GetActivationSettings().InitialDelay);
+}
+
+void UTrapActivationScheduler::UnregisterTrap(ATrapBase* Trap)
+{
+	if (const int32* EntryIndex = EntryIndexMap.Find(Trap))
+	{
+		RemoveEntry(*EntryIndex);
+	}
+}
+
+void UTrapActivationScheduler::RemoveEntry(int32 EntryIndex)
+{
+	const FTrapActivationEntry& Entry = EntryList[EntryIndex];
+	EntryIndexMap.Remove(Entry.TrapKey);
+
+	if (Wheel.IsValidIndex(Entry.SlotIndex))
+	{
+		Wheel[Entry.SlotIndex].RemoveSwap(EntryIndex);
+	}
+
+	EntryList.RemoveAt(EntryIndex);
+}
+
+void UTrapActivationScheduler::Schedule(int32 EntryIndex, float Delay)
+{
+	FTrapActivationEntry& Entry = EntryList[EntryIndex];
+
+	if (Wheel.IsValidIndex(Entry.SlotIndex))
+	{
+		Wheel[Entry.SlotIndex].RemoveSwap(EntryIndex);
+	}
+
+	Entry.DueTick = CurrentTick + FMath::Max(FMath::CeilToInt(Delay / SlotDuration), 1);
+	Entry.SlotIndex = int32(Entry.DueTick % WheelSize);
+	Wheel[Entry.SlotIndex].Add(EntryIndex);
+}
+
+void UTrapActivationScheduler::Tick(float DeltaTime)
+{
+	if (!GetWorld())
+	{
+		return;
+	}
+
+	const int64 TargetTick = GetTickForTime(GetWorld()->GetTimeSeconds());
+
+	//Every outstanding entry lives in some slot, so a single revolution is enough to collect everything that is due.
+	if (TargetTick - CurrentTick > WheelSize)
+	{
+		CurrentTick = TargetTick - WheelSize;
+	}
+
+	while (CurrentTick < TargetTick)
+	{
+		CurrentTick++;
+
+		TArray<int32>& Slot = Wheel[int32(CurrentTick % WheelSize)];
+		for (int32 Index = Slot.Num() - 1; Index >= 0; Index--)
+		{
+			FTrapActivationEntry& Entry = EntryList[Slot[Index]];
+
+			if (Entry.DueTick > TargetTick)
+			{
+				continue;
+			}
+
+			Entry.SlotIndex = INDEX_NONE;
+			DueEntryList.Add(Slot[Index]);
+			Slot.RemoveAtSwap(Index, 1, false);
+		}
+	}
+
+	if (DueEntryList.Num() > 0)
+	{
+		ActivateDueTraps();
+	}
+}
+
+void UTrapActivationScheduler::ActivateDueTraps()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TrapActivationSchedulerActivateDueTraps);
+
+	//Group activations by trap class so that traps sharing settings, components and blueprint code run back to back.
+	DueEntryList.Sort([this](int32 A, int32 B)
+	{
+		const UClass* ClassA = EntryList[A].TrapClass;
+		const UClass* ClassB = EntryList[B].TrapClass;
+		return ClassA != ClassB ? ClassA < ClassB : A < B;
+	});
+
+	const int32 MaxActivationCount = CVarTrapActivationMaxPerFrame.GetValueOnGameThread();
+	const int32 ActivationCount = MaxActivationCount > 0 ? FMath::Min(MaxActivationCount, DueEntryList.Num()) : DueEntryList.Num();
+
+	//Gather pawn locations and collision radii once for the whole batch so traps with nothing nearby can skip their overlap query.
+	static TArray<FSphere> PawnSphereList;
+	PawnSphereList.Reset();
+	for (TActorIterator<APawn> Itr(GetWorld()); Itr; ++Itr)
+	{
+		if (Itr->IsPendingKillPending())
+		{
+			continue;
+		}
+
+		PawnSphereList.Add(FSphere(Itr->GetActorLocation(), Itr->GetSimpleCollisionRadius()));
+	}
+
+	int32 ActivatedCount = 0;
+	for (int32 Index = 0; Index < ActivationCount; Index++)
+	{
+		const int32 EntryIndex = DueEntryList[Index];
+
+		//Entries may have been unregistered (or the index reused) by a trap activated earlier in this batch.
+		if (!EntryList.IsAllocated(EntryIndex) || EntryList[EntryIndex].SlotIndex != INDEX_NONE)
+		{
+			continue;
+		}
+
+		ATrapBase* Trap = EntryList[EntryIndex].Trap.Get();
+
+		if (!Trap || Trap->IsPendingKillPending())
+		{
+			RemoveEntry(EntryIndex);
+			continue;
+		}
+
+		const FTrapActivationSettings& Settings = Trap->GetActivationSettings();
+
+		bool bMayHaveTargets = false;
+		if (const UPrimitiveComponent* ActivationComponent = Trap->GetActivationComponent())
+		{
+			const FBoxSphereBounds& Bounds = ActivationComponent->Bounds;
+			//Pad by a grid cell and by each pawn's own collision radius so large pawns whose capsule reaches the trap are not skipped.
+			const float Range = Bounds.SphereRadius + TrapGridSize;
+			for (const FSphere& PawnSphere : PawnSphereList)
+			{
+				if (FVector::DistSquared(PawnSphere.Center, Bounds.Origin) <= FMath::Square(Range + PawnSphere.W))
+				{
+					bMayHaveTargets = true;
+					break;
+				}
+			}
+		}
+
+		const bool bActivated = Trap->TryActivate(bMayHaveTargets);
+		ActivatedCount += bActivated ? 1 : 0;
+
+		if (!EntryList.IsAllocated(EntryIndex) || EntryList[EntryIndex].Trap.Get() != Trap)
+		{
+			continue;
+		}
+
+		Schedule(EntryIndex, bActivated ? Settings.Cooldown : Settings.TriggerCheckInterval);
+	}
+
+	INC_DWORD_STAT_BY(STAT_TrapActivationSchedulerActivatedTraps, ActivatedCount);
+
+	//Anything over the per-frame limit is due again next frame.
+	for (int32 Index = ActivationCount; Index < DueEntryList.Num(); Index++)
+	{
+		const int32 EntryIndex = DueEntryList[Index];
+		if (EntryList.IsAllocated(EntryIndex) && EntryList[EntryIndex].SlotIndex == INDEX_NONE)
+		{
+			Schedule(EntryIndex, 0.f);
+		}
+	}
+
+	DueEntryList.Reset();
+}
\ No newline at end of file
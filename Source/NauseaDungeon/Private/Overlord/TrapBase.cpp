@@ -6,6 +6,9 @@
 #include "Player/DungeonPlayerController.h"
 #include "Player/DungeonPlayerState.h"
 #include "Overlord/PlacementActor.h"
+#include "Overlord/TrapActivationScheduler.h"
+#include "Gameplay/CoreDamageType.h"
+#include "GameFramework/PlayerState.h"
 #include "Components/PrimitiveComponent.h"
 #include "UI/CoreWidgetComponent.h"
 
@@ -14,6 +17,9 @@ ATrapBase::ATrapBase(const FObjectInitializer& ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = true;
 	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	//Placed traps only change state when triggered, upgraded or removed. See NotifyTrapStateChanged.
+	NetDormancy = DORM_DormantAll;
 }
 
 void ATrapBase::PostInitializeComponents()
@@ -33,6 +39,52 @@ void ATrapBase::PostInitializeComponents()
 	Super::PostInitializeComponents();
 }
 
+void ATrapBase::BeginPlay()
+{
+	Super::BeginPlay();
+
+	ActivationComponent = Cast<UPrimitiveComponent>(GetRootComponent());
+	if (ActivationSettings.ActivationComponentName != NAME_None)
+	{
+		TInlineComponentArray<UPrimitiveComponent*> PrimitiveComponents(this);
+		for (UPrimitiveComponent* Component : PrimitiveComponents)
+		{
+			if (Component && Component->GetFName() == ActivationSettings.ActivationComponentName)
+			{
+				ActivationComponent = Component;
+				break;
+			}
+		}
+	}
+
+	if (ActivationSettings.bUseNativeActivation && GetLocalRole() == ROLE_Authority)
+	{
+		if (UTrapActivationScheduler* TrapActivationScheduler = UTrapActivationScheduler::Get(this))
+		{
+			TrapActivationScheduler->RegisterTrap(this);
+		}
+	}
+}
+
+void ATrapBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ActivationSettings.bUseNativeActivation)
+	{
+		if (UTrapActivationScheduler* TrapActivationScheduler = UTrapActivationScheduler::Get(this))
+		{
+			TrapActivationScheduler->UnregisterTrap(this);
+		}
+	}
+
+	//Release our points explicitly so that cached grid availability and replicated occupancy do not keep them marked as occupied.
+	if (OccupiedPlacementActor.IsValid())
+	{
+		RevokeOccupancy();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 EPlacementResult ATrapBase::CanPlaceTrapOnTarget(ADungeonPlayerController* PlacementInstigator, APlacementActor* TargetPlacementActor) const
 {
 	if (!TargetPlacementActor || (GetPlacementType() & TargetPlacementActor->GetPlacementType()) == 0)
@@ -63,6 +115,8 @@ void ATrapBase::SetOccupancy(APlacementActor* TargetPlacementActor, const FPlace
 		return;
 	}
 
+	NotifyTrapStateChanged();
+
 	OccupiedPlacementActor = TargetPlacementActor;
 	OccupiedHandleList.Reset();
 
@@ -91,14 +145,18 @@ void ATrapBase::SetOccupancy(APlacementActor* TargetPlacementActor, const FPlace
 
 			ensure(TargetGrid.IsValidPoint(IndexX, IndexY, true));
 
-			TargetGrid.SetOccupant(IndexX, IndexY, this);
+			TargetPlacementActor->SetPlacementOccupant(IndexX, IndexY, this);
 			OccupiedHandleList.Add(TargetGrid.Get(IndexX, IndexY).GetHandle());
 		}
 	}
+
+	TargetPlacementActor->NotifyPlacementOccupancyChanged();
 }
 
 void ATrapBase::RevokeOccupancy()
 {
+	NotifyTrapStateChanged();
+
 	if (!ensure(OccupiedPlacementActor.IsValid()))
 	{
 		OccupiedPlacementActor = nullptr;
@@ -117,9 +175,11 @@ void ATrapBase::RevokeOccupancy()
 
 	for (const FPlacementHandle& OccupiedHandle : OccupiedHandleList)
 	{
-		TargetGrid.ClearPlacementOccupantByHandle(OccupiedHandle);
+		OccupiedPlacementActor->ClearPlacementOccupantByHandle(OccupiedHandle);
 	}
 
+	OccupiedPlacementActor->NotifyPlacementOccupancyChanged();
+
 	OccupiedPlacementActor = nullptr;
 	OccupiedHandleList.Reset();
 }
@@ -158,11 +218,84 @@ TArray<AActor*> ATrapBase::PerformOverlapTestWithPrimitiveAndApplyDamage(UPrimit
 	static TArray<AActor*> OverlapActorList;
 	OverlapActorList = PerformOverlapTestWithPrimitive(Component, ActorClassFilter, ActorsToIgnore);
 
-	
+	if (OverlapActorList.Num() > 0)
+	{
+		NotifyTrapStateChanged();
+		ApplyActivationDamage(OverlapActorList);
+	}
 
 	return OverlapActorList;
 }
 
+bool ATrapBase::TryActivate(bool bMayHaveTargets)
+{
+	static TArray<AActor*> HitActorList;
+	HitActorList.Reset();
+
+	if (bMayHaveTargets && ActivationComponent)
+	{
+		HitActorList = PerformOverlapTestWithPrimitive(ActivationComponent, nullptr, TArray<AActor*>());
+	}
+
+	if (ActivationSettings.TriggerCondition == ETrapTriggerCondition::PawnInRange && HitActorList.Num() == 0)
+	{
+		return false;
+	}
+
+	//Periodic activations that hit nothing change no replicated state, so don't wake the trap from dormancy for them.
+	if (HitActorList.Num() > 0)
+	{
+		NotifyTrapStateChanged();
+		ApplyActivationDamage(HitActorList);
+	}
+
+	K2_OnTrapActivated(HitActorList);
+	return true;
+}
+
+void ATrapBase::ApplyActivationDamage(const TArray<AActor*>& ActorList)
+{
+	if (!ActivationSettings.DamageType || ActorList.Num() == 0 || GetLocalRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	const float Damage = ActivationSettings.Damage >= 0.f ? ActivationSettings.Damage : ActivationSettings.DamageType.GetDefaultObject()->GetDamageAmount();
+	const FDamageEvent DamageEvent(ActivationSettings.DamageType);
+	AController* InstigatorController = GetTrapInstigatorController();
+
+	for (AActor* Actor : ActorList)
+	{
+		if (!Actor || Actor->IsPendingKillPending())
+		{
+			continue;
+		}
+
+		Actor->TakeDamage(Damage, DamageEvent, InstigatorController, this);
+	}
+}
+
+AController* ATrapBase::GetTrapInstigatorController() const
+{
+	if (AController* OwnerController = Cast<AController>(GetOwner()))
+	{
+		return OwnerController;
+	}
+
+	const APlayerState* OwningPlayerState = Cast<APlayerState>(GetOwner());
+	return OwningPlayerState ? Cast<AController>(OwningPlayerState->GetOwner()) : nullptr;
+}
+
+void ATrapBase::NotifyTrapStateChanged()
+{
+	if (GetLocalRole() != ROLE_Authority || !GetIsReplicated())
+	{
+		return;
+	}
+
+	FlushNetDormancy();
+}
+
 TSoftObjectPtr<UTexture2D> ATrapBase::GetTrapIconForClass(TSubclassOf<ATrapBase> TrapClass)
 {
 	if (const ATrapBase* TrapCDO = TrapClass.GetDefaultObject())
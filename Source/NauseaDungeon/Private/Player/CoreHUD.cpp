@@ -7,6 +7,34 @@
 #include "Player/CorePlayerState.h"
 #include "UI/CoreUserWidget.h"
 #include "Player/PlayerPromptComponent.h"
+#include "Components/Widget.h"
+
+void FWidgetPool::PushWidget(UWidget* Widget)
+{
+	if (!Widget || Contains(Widget))
+	{
+		return;
+	}
+
+	Pool.Push(Widget);
+	CachedSlateWidgetMap.Add(Widget, Widget->GetCachedWidget());
+}
+
+UWidget* FWidgetPool::PopWidget()
+{
+	while (Pool.Num() > 0)
+	{
+		UWidget* Widget = Pool.Pop(false);
+		CachedSlateWidgetMap.Remove(Widget);
+
+		if (Widget && !Widget->IsPendingKill())
+		{
+			return Widget;
+		}
+	}
+
+	return nullptr;
+}
 
 ACoreHUD::ACoreHUD(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -50,6 +78,13 @@ void ACoreHUD::PostInitializeComponents()
 	}
 }
 
+void ACoreHUD::BeginPlay()
+{
+	Super::BeginPlay();
+
+	PrewarmWidgetPool();
+}
+
 ACorePlayerController* ACoreHUD::GetOwningCorePlayerController() const
 {
 	return Cast<ACorePlayerController>(PlayerOwner);
@@ -65,6 +100,70 @@ void ACoreHUD::ReleaseWidgetToPool(UWidget* Widget)
 	WidgetPool.FindOrAdd(Widget->GetClass()).PushWidget(Widget);
 }
 
+UCoreUserWidget* ACoreHUD::AcquireWidgetFromPool(TSubclassOf<UCoreUserWidget> WidgetClass)
+{
+	if (!WidgetClass)
+	{
+		return nullptr;
+	}
+
+	UCoreUserWidget* Widget = GetWidgetFromPool<UCoreUserWidget>(WidgetClass);
+
+	if (Widget)
+	{
+		Widget->NotifyAcquiredFromPool();
+	}
+
+	return Widget;
+}
+
+UCoreUserWidget* ACoreHUD::AcquireWidget(TSubclassOf<UCoreUserWidget> WidgetClass)
+{
+	if (!WidgetClass)
+	{
+		return nullptr;
+	}
+
+	if (UCoreUserWidget* Widget = AcquireWidgetFromPool(WidgetClass))
+	{
+		return Widget;
+	}
+
+	return CreateWidget<UCoreUserWidget>(GetOwningPlayerController(), WidgetClass);
+}
+
+void ACoreHUD::PrewarmWidgetPool()
+{
+	if (!GetOwningPlayerController() || !GetOwningPlayerController()->IsLocalPlayerController())
+	{
+		return;
+	}
+
+	for (const TPair<TSubclassOf<UCoreUserWidget>, int32>& PrewarmEntry : WidgetPoolPrewarmMap)
+	{
+		if (!PrewarmEntry.Key)
+		{
+			continue;
+		}
+
+		FWidgetPool& Pool = WidgetPool.FindOrAdd(PrewarmEntry.Key);
+
+		while (Pool.Num() < PrewarmEntry.Value)
+		{
+			UCoreUserWidget* Widget = CreateWidget<UCoreUserWidget>(GetOwningPlayerController(), PrewarmEntry.Key);
+
+			if (!Widget)
+			{
+				break;
+			}
+
+			//Build the Slate tree now so it is ready when the widget is first acquired.
+			Widget->TakeWidget();
+			Pool.PushWidget(Widget);
+		}
+	}
+}
+
 void ACoreHUD::ReceivedPlayerDataReady()
 {
 	OnPlayerDataReady(GetOwningCorePlayerController(), GetOwningCorePlayerController()->GetPlayerStatisticsComponent());
@@ -4,12 +4,14 @@
 #include "GameFramework/InputSettings.h"
 #include "Runtime/Engine/Classes/Components/DecalComponent.h"
 #include "Blueprint/AIBlueprintHelperLibrary.h"
+#include "Engine/AssetManager.h"
 #include "Engine/World.h"
 #include "NauseaGlobalDefines.h"
 #include "Overlord/DungeonGameState.h"
 #include "Player/DungeonPlayerState.h"
 #include "Character/DungeonCharacter.h"
 #include "Overlord/PlacementActor.h"
+#include "Overlord/OverlordWorldSettings.h"
 #include "Overlord/TrapBase.h"
 #include "DrawDebugHelpers.h"
 
@@ -18,6 +20,11 @@ static TAutoConsoleVariable<int32> CVarPlacementTestMode(
 	0,
 	TEXT("Enable changing build button to update hit test location instead of building."));
 
+static TAutoConsoleVariable<float> CVarPlacementRefreshInterval(
+	TEXT("grid.PlacementRefreshInterval"),
+	0.25f,
+	TEXT("Interval (in seconds) at which placement preview is refreshed while the cursor and view are idle. Catches occupancy and fund changes. 0 disables idle refreshes."));
+
 ADungeonPlayerController::ADungeonPlayerController(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -52,10 +59,15 @@ void ADungeonPlayerController::PlayerTick(float DeltaTime)
 
 	bTestPlacement = CVarPlacementTestMode.GetValueOnGameThread() != 0;
 
+	if (!ShouldUpdatePlacement())
+	{
+		return;
+	}
+
 	FHitResult HitResult;
 	if (!bTestPlacement)
 	{
-		GetHitResultUnderCursor(ECC_PlacementTrace, false, HitResult);
+		GetPlacementHitResult(HitResult);
 	}
 	else
 	{
@@ -90,20 +102,16 @@ void ADungeonPlayerController::SetPlacementTrapClass(TSubclassOf<ATrapBase> Trap
 	}
 
 	PlacementTrapClass = TrapClass;
+	PlacementTrapPreviewStreamableHandle.Reset();
+
+	ResolvePlacementTrapPreviewClass();
 
 	if (const ATrapBase* TrapCDO = GetPlacementTrapCDO())
 	{
-		PlacementTrapPreviewClass = TrapCDO->GetPlacementPreviewActor().LoadSynchronous();
-	}
-	else
-	{
-		PlacementTrapPreviewClass = nullptr;
-	}
-	
-	if (TrapPreviewActor && !TrapPreviewActor->IsPendingKillPending() && (TrapPreviewActor->GetClass() != PlacementTrapPreviewClass))
-	{
-		TrapPreviewActor->Destroy();
-		TrapPreviewActor = nullptr;
+		if (!PlacementTrapPreviewClass)
+		{
+			RequestPlacementTrapPreviewClass(TrapCDO->GetPlacementPreviewActor());
+		}
 	}
 
 	OnSelectedTrapClassUpdate.Broadcast(this, PlacementTrapClass);
@@ -127,18 +135,214 @@ void ADungeonPlayerController::SetPlacementEnabled(bool bEnabled)
 	}
 
 	bPlacementEnabled = bEnabled;
+	MarkPlacementDirty();
 
-	if (!bPlacementEnabled)
+	if (bPlacementEnabled)
+	{
+		PreloadTrapLoadout();
+	}
+	else
 	{
 		ClearPlacementTrapClass();
+		TrapLoadoutStreamableHandle.Reset();
+		TrapPreviewStreamableHandle.Reset();
 	}
 }
 
+void ADungeonPlayerController::PreloadTrapLoadout()
+{
+	if (!IsLocalController())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> TrapPathList;
+	for (const TSoftClassPtr<ATrapBase>& SoftTrapClass : TrapLoadout)
+	{
+		if (SoftTrapClass.IsNull())
+		{
+			continue;
+		}
+
+		TrapPathList.AddUnique(SoftTrapClass.ToSoftObjectPath());
+	}
+
+	if (TrapPathList.Num() == 0)
+	{
+		return;
+	}
+
+	UAssetManager* AssetManager = UAssetManager::GetIfValid();
+
+	if (!AssetManager)
+	{
+		return;
+	}
+
+	FStreamableManager& StreamableManager = AssetManager->GetStreamableManager();
+	TrapLoadoutStreamableHandle = StreamableManager.RequestAsyncLoad(TrapPathList, FStreamableDelegate::CreateUObject(this, &ADungeonPlayerController::OnTrapLoadoutLoaded));
+}
+
+void ADungeonPlayerController::OnTrapLoadoutLoaded()
+{
+	TArray<FSoftObjectPath> PreviewPathList;
+	for (const TSoftClassPtr<ATrapBase>& SoftTrapClass : TrapLoadout)
+	{
+		const ATrapBase* TrapCDO = SoftTrapClass.Get() ? SoftTrapClass.Get()->GetDefaultObject<ATrapBase>() : nullptr;
+
+		if (!TrapCDO || TrapCDO->GetPlacementPreviewActor().IsNull())
+		{
+			continue;
+		}
+
+		PreviewPathList.AddUnique(TrapCDO->GetPlacementPreviewActor().ToSoftObjectPath());
+	}
+
+	if (PreviewPathList.Num() == 0)
+	{
+		return;
+	}
+
+	UAssetManager* AssetManager = UAssetManager::GetIfValid();
+
+	if (!AssetManager)
+	{
+		return;
+	}
+
+	FStreamableManager& StreamableManager = AssetManager->GetStreamableManager();
+	TrapPreviewStreamableHandle = StreamableManager.RequestAsyncLoad(PreviewPathList, FStreamableDelegate::CreateUObject(this, &ADungeonPlayerController::OnPlacementTrapPreviewClassLoaded));
+}
+
+void ADungeonPlayerController::RequestPlacementTrapPreviewClass(const TSoftClassPtr<ATrapPreview>& SoftPreviewClass)
+{
+	if (SoftPreviewClass.IsNull())
+	{
+		return;
+	}
+
+	UAssetManager* AssetManager = UAssetManager::GetIfValid();
+
+	if (!AssetManager)
+	{
+		return;
+	}
+
+	FStreamableManager& StreamableManager = AssetManager->GetStreamableManager();
+	PlacementTrapPreviewStreamableHandle = StreamableManager.RequestAsyncLoad(SoftPreviewClass.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &ADungeonPlayerController::OnPlacementTrapPreviewClassLoaded));
+}
+
+void ADungeonPlayerController::OnPlacementTrapPreviewClassLoaded()
+{
+	const ATrapBase* TrapCDO = GetPlacementTrapCDO();
+
+	if (!TrapCDO || PlacementTrapPreviewClass == TrapCDO->GetPlacementPreviewActor().Get())
+	{
+		return;
+	}
+
+	ResolvePlacementTrapPreviewClass();
+}
+
+void ADungeonPlayerController::ResolvePlacementTrapPreviewClass()
+{
+	const ATrapBase* TrapCDO = GetPlacementTrapCDO();
+	PlacementTrapPreviewClass = TrapCDO ? TrapCDO->GetPlacementPreviewActor().Get() : nullptr;
+
+	const TSubclassOf<ATrapPreview> DesiredPreviewClass = (PlacementTrapPreviewClass || !TrapCDO) ? PlacementTrapPreviewClass : PlaceholderTrapPreviewClass;
+
+	if (TrapPreviewActor && !TrapPreviewActor->IsPendingKillPending() && (TrapPreviewActor->GetClass() != DesiredPreviewClass))
+	{
+		TrapPreviewActor->Destroy();
+		TrapPreviewActor = nullptr;
+	}
+
+	MarkPlacementDirty();
+}
+
 void ADungeonPlayerController::OnMatchStateChanged(ACoreGameState* GameState, FName MatchState)
 {
 	SetPlacementEnabled(GameState->IsInProgress());
 }
 
+bool ADungeonPlayerController::ShouldUpdatePlacement()
+{
+	FVector2D MousePosition = FVector2D(-1.f);
+	if (!GetMousePosition(MousePosition.X, MousePosition.Y))
+	{
+		MousePosition = FVector2D(-1.f);
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const float CurrentTime = GetWorld()->GetRealTimeSeconds();
+	const float RefreshInterval = CVarPlacementRefreshInterval.GetValueOnGameThread();
+
+	const bool bShouldUpdate = bPlacementUpdatePending
+		|| MousePosition != LastPlacementMousePosition
+		|| !ViewLocation.Equals(LastPlacementViewLocation)
+		|| !ViewRotation.Equals(LastPlacementViewRotation)
+		|| PlacementTrapClass != LastPlacementUpdateTrapClass
+		|| Rotation != LastPlacementUpdateRotation
+		|| (RefreshInterval > 0.f && CurrentTime - LastPlacementUpdateTime >= RefreshInterval);
+
+	if (!bShouldUpdate)
+	{
+		return false;
+	}
+
+	bPlacementUpdatePending = false;
+	LastPlacementMousePosition = MousePosition;
+	LastPlacementViewLocation = ViewLocation;
+	LastPlacementViewRotation = ViewRotation;
+	LastPlacementUpdateTrapClass = PlacementTrapClass;
+	LastPlacementUpdateRotation = Rotation;
+	LastPlacementUpdateTime = CurrentTime;
+	return true;
+}
+
+bool ADungeonPlayerController::GetPlacementHitResult(FHitResult& HitResult)
+{
+	//If the cursor is still over the last hovered grid we can resolve the location without a physics trace.
+	FVector RayOrigin, RayDirection;
+	if (LastPlacementActor.IsValid() && DeprojectMousePositionToWorld(RayOrigin, RayDirection))
+	{
+		FVector GridLocation;
+		if (LastPlacementActor->GetParentmostPlacementGrid().GetRayIntersection(RayOrigin, RayDirection, GridLocation))
+		{
+			HitResult = FHitResult(LastPlacementActor.Get(), nullptr, GridLocation, -RayDirection);
+			HitResult.bBlockingHit = true;
+			return true;
+		}
+	}
+
+	if (!GetHitResultUnderCursor(ECC_PlacementTrace, false, HitResult) || !HitResult.bBlockingHit)
+	{
+		LastPlacementActor = nullptr;
+		return false;
+	}
+
+	LastPlacementActor = Cast<APlacementActor>(HitResult.GetActor());
+
+	//The trace landed on something other than a placement actor's collider, resolve the owning grid from the world placement index instead.
+	if (!LastPlacementActor.IsValid())
+	{
+		FPlacementCoordinates Coordinates;
+		const FPlacementSpatialIndex* SpatialIndex = AOverlordWorldSettings::FindPlacementSpatialIndex(this);
+		LastPlacementActor = SpatialIndex ? SpatialIndex->FindPlacementActor(HitResult.Location, Coordinates) : nullptr;
+
+		if (LastPlacementActor.IsValid())
+		{
+			HitResult.Actor = LastPlacementActor.Get();
+			HitResult.Component = nullptr;
+		}
+	}
+
+	return true;
+}
+
 bool ADungeonPlayerController::UpdatePlacement(const FHitResult& HitResult, FTransform& PlacementTransform)
 {
 	if (!HitResult.bBlockingHit)
@@ -204,7 +408,8 @@ void ADungeonPlayerController::UpdatePreviewActor(bool bActive, const FTransform
 
 	if (!TrapPreviewActor)
 	{
-		TSubclassOf<ATrapPreview> PreviewActorClass = PlacementTrapCDO->GetPlacementPreviewActor().Get();
+		//Fall back to the placeholder while the trap's own preview class is still loading.
+		TSubclassOf<ATrapPreview> PreviewActorClass = PlacementTrapPreviewClass ? PlacementTrapPreviewClass : PlaceholderTrapPreviewClass;
 
 		if(!PreviewActorClass)
 		{
@@ -231,13 +436,14 @@ void ADungeonPlayerController::UpdatePreviewActor(bool bActive, const FTransform
 void ADungeonPlayerController::OnBuildPressed()
 {
 	FHitResult HitResult;
-	GetHitResultUnderCursor(ECC_PlacementTrace, false, HitResult);
+	GetPlacementHitResult(HitResult);
 
 	bTestPlacement = CVarPlacementTestMode.GetValueOnGameThread() != 0;
 
 	if (bTestPlacement)
 	{
 		TestHitResult = HitResult;
+		MarkPlacementDirty();
 		return;
 	}
 
@@ -298,6 +504,8 @@ void ADungeonPlayerController::OnBuildPressed()
 	{
 		DungeonPlayerState->RemoveTrapCoins(PlacementTrapCDO->GetCost());
 	}
+
+	MarkPlacementDirty();
 }
 
 void ADungeonPlayerController::OnCancelBuildPressed()
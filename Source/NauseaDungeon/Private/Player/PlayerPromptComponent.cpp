@@ -12,46 +12,40 @@ bool FPromptStack::IsValidPromptHandle(const FPromptHandle& PromptHandle) const
 		return false;
 	}
 
-	return PromptMap.Contains(PromptHandle);
+	return PromptIndexMap.Contains(PromptHandle);
 }
 
 const FPromptHandle& FPromptStack::PushPrompt(class UPlayerPromptComponent* PlayerPromptComponent, FPromptData&& InPromptData)
 {
 	const FPromptHandle& InPromptHandle = InPromptData.GetPromptHandle();
-
-	const uint8 PushPriority = InPromptData.GetPriority();
 	const EPromptDuplicateLogic PromptDuplicateLogic = InPromptData.GetPromptDuplicateLogic();
 	
 	if (PromptDuplicateLogic != EPromptDuplicateLogic::AllowDuplicate)
 	{
 		const TSubclassOf<UPromptInfo>& PromptInfoClass = InPromptData.GetPromptInfoClass();
-		TArray<FPromptHandle> PromptHandleList;
-		PromptMap.GenerateKeyArray(PromptHandleList);
 
-		for (const FPromptHandle& PromptHandle : PromptHandleList)
+		if (const FPromptHandle* DuplicatePromptHandlePtr = UniquePromptMap.Find(PromptInfoClass))
 		{
-			if (PromptMap[PromptHandle].GetPromptInfoClass() != PromptInfoClass)
-			{
-				continue;
-			}
-
-			const FPromptHandle& DuplicatePromptHandle = PromptMap[PromptHandle].GetPromptHandle();
+			const FPromptHandle DuplicatePromptHandle = *DuplicatePromptHandlePtr;
 
 			switch (PromptDuplicateLogic)
 			{
 			case EPromptDuplicateLogic::ReplaceWithNewer:
 				if (PlayerPromptComponent) { PlayerPromptComponent->DismissPrompt(DuplicatePromptHandle); }
-				PromptMap.Remove(PromptHandle);
-				PromptMap.Add(InPromptHandle) = MoveTemp(InPromptData);
-				return InPromptHandle;
+				RemovePrompt(DuplicatePromptHandle);
+				break;
 			case EPromptDuplicateLogic::Ignore:
 				return FPromptHandle::InvalidHandle;
 			}
 		}
+
+		UniquePromptMap.Add(PromptInfoClass, InPromptHandle);
 	}
 
-	PromptMap.Add(InPromptHandle) = MoveTemp(InPromptData);
-	return InPromptHandle;
+	const FPromptHandle PromptHandle = InPromptHandle;
+	AddPrompt(MoveTemp(InPromptData));
+	UpdateTopPrompt();
+	return PromptList[PromptIndexMap[PromptHandle]].GetPromptHandle();
 }
 
 bool FPromptStack::PopPrompt(class UPlayerPromptComponent* PlayerPromptComponent, const FPromptHandle& PromptHandle)
@@ -61,20 +55,23 @@ bool FPromptStack::PopPrompt(class UPlayerPromptComponent* PlayerPromptComponent
 		return false;
 	}
 
-	if (PlayerPromptComponent && PromptMap[PromptHandle].IsMarkedDisplayed())
+	if (PlayerPromptComponent && IsMarkedDisplayed(PromptHandle))
 	{
 		PlayerPromptComponent->DismissPrompt(PromptHandle);
 	}
 
-	PromptMap.Remove(PromptHandle);
+	//Copied since the handle passed in may reference the prompt being removed.
+	const FPromptHandle RemovedPromptHandle = PromptHandle;
+	RemovePrompt(RemovedPromptHandle);
+	UpdateTopPrompt();
 	return true;
 }
 
 const FPromptData& FPromptStack::GetPromptData(const FPromptHandle& PromptHandle) const
 {
-	if (IsValidPromptHandle(PromptHandle))
+	if (const int32* PromptIndex = PromptHandle.IsValid() ? PromptIndexMap.Find(PromptHandle) : nullptr)
 	{
-		return PromptMap[PromptHandle];
+		return PromptList[*PromptIndex];
 	}
 
 	return FPromptData::InvalidPrompt;
@@ -106,40 +103,84 @@ bool FPromptStack::MarkDisplayed(const FPromptHandle& PromptHandle)
 
 const FPromptData& FPromptStack::GetTopData() const
 {
-	if (PromptMap.Num() == 0)
+	if (TopPromptIndex == INDEX_NONE)
 	{
 		return FPromptData::InvalidPrompt;
 	}
 
-	TArray<FPromptHandle> PromptHandleList;
-	PromptMap.GenerateKeyArray(PromptHandleList);
+	return PromptList[TopPromptIndex];
+}
+
+FPromptData& FPromptStack::GetTopDataMutable()
+{
+	return const_cast<FPromptData&>(GetTopData());
+}
+
+void FPromptStack::AddPrompt(FPromptData&& PromptData)
+{
+	PromptHeap.HeapPush(FPromptHeapEntry(PromptData));
+	const FPromptHandle PromptHandle = PromptData.GetPromptHandle();
+	PromptIndexMap.Add(PromptHandle, PromptList.Add(MoveTemp(PromptData)));
+}
 
-	FPromptHandle HighestPriorityHandle = FPromptHandle::InvalidHandle;
+void FPromptStack::RemovePrompt(const FPromptHandle& PromptHandle)
+{
+	int32 PromptIndex = INDEX_NONE;
 
-	for (const FPromptHandle& PromptHandle : PromptHandleList)
+	if (!PromptIndexMap.RemoveAndCopyValue(PromptHandle, PromptIndex))
 	{
-		if (!HighestPriorityHandle.IsValid())
-		{
-			HighestPriorityHandle = PromptHandle;
-		}
+		return;
+	}
 
-		if (PromptMap[PromptHandle] > PromptMap[HighestPriorityHandle])
-		{
-			HighestPriorityHandle = PromptHandle;
-		}
+	const TSubclassOf<UPromptInfo>& PromptInfoClass = PromptList[PromptIndex].GetPromptInfoClass();
+	const FPromptHandle* UniquePromptHandle = UniquePromptMap.Find(PromptInfoClass);
+
+	if (UniquePromptHandle && *UniquePromptHandle == PromptHandle)
+	{
+		UniquePromptMap.Remove(PromptInfoClass);
 	}
 
-	if (IsValidPromptHandle(HighestPriorityHandle))
+	PromptList.RemoveAtSwap(PromptIndex, 1, false);
+
+	if (PromptList.IsValidIndex(PromptIndex))
 	{
-		return PromptMap[HighestPriorityHandle];
+		PromptIndexMap[PromptList[PromptIndex].GetPromptHandle()] = PromptIndex;
 	}
 
-	return FPromptData::InvalidPrompt;
+	//Stale entries are only popped once they reach the top. If a long-lived prompt stays on top they pile up underneath it, so rebuild once they outnumber live prompts.
+	if (PromptHeap.Num() > 2 * PromptList.Num())
+	{
+		RebuildPromptHeap();
+	}
 }
 
-FPromptData& FPromptStack::GetTopDataMutable()
+void FPromptStack::RebuildPromptHeap()
 {
-	return const_cast<FPromptData&>(GetTopData());
+	PromptHeap.Reset(PromptList.Num());
+
+	for (const FPromptData& PromptData : PromptList)
+	{
+		PromptHeap.Add(FPromptHeapEntry(PromptData));
+	}
+
+	PromptHeap.Heapify();
+}
+
+void FPromptStack::UpdateTopPrompt()
+{
+	if (PromptList.Num() == 0)
+	{
+		PromptHeap.Reset();
+		TopPromptIndex = INDEX_NONE;
+		return;
+	}
+
+	while (PromptHeap.Num() > 0 && !PromptIndexMap.Contains(PromptHeap.HeapTop().PromptHandle))
+	{
+		PromptHeap.HeapPopDiscard();
+	}
+
+	TopPromptIndex = PromptHeap.Num() > 0 ? PromptIndexMap[PromptHeap.HeapTop().PromptHandle] : INDEX_NONE;
 }
 
 UPlayerPromptComponent::UPlayerPromptComponent(const FObjectInitializer& ObjectInitializer)
@@ -180,7 +221,7 @@ const FPromptHandle& UPlayerPromptComponent::PushPlayerPrompt(TSubclassOf<UPromp
 		return FPromptHandle::InvalidHandle;
 	}
 
-	const FPromptHandle& PromptHandle = PromptStack.PushPrompt(this, FPromptData::GeneratePrompt(PromptInfo, Delegate));
+	const FPromptHandle PromptHandle = PromptStack.PushPrompt(this, FPromptData::GeneratePrompt(PromptInfo, Delegate));
 
 	const FPromptData& TopPromptData = PromptStack.GetTopData();
 	if (TopPromptData.IsValid() && !TopPromptData.IsMarkedDisplayed())
@@ -188,7 +229,8 @@ const FPromptHandle& UPlayerPromptComponent::PushPlayerPrompt(TSubclassOf<UPromp
 		DisplayPrompt(TopPromptData.GetPromptHandle());
 	}
 
-	return PromptHandle;
+	//Return the handle stored in the stack (or the invalid handle if it has already been popped) rather than a reference to a temporary.
+	return PromptStack.GetPromptData(PromptHandle).GetPromptHandle();
 }
 
 bool UPlayerPromptComponent::PopPlayerPrompt(const FPromptHandle& PromptHandle)
@@ -3,6 +3,8 @@
 
 #include "Spawn/SpawnVolume.h"
 #include "Character/CoreCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "NauseaGlobalDefines.h"
 
 #if WITH_EDITOR
 #include "LevelEditor.h"
@@ -11,6 +13,39 @@
 extern UNREALED_API UEditorEngine* GEditor;
 #endif
 
+DECLARE_STATS_GROUP(TEXT("SpawnVolume"), STATGROUP_SpawnVolume, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Get Spawn Transform"), STAT_SpawnVolumeGetSpawnTransform, STATGROUP_SpawnVolume);
+DECLARE_CYCLE_STAT(TEXT("Validate Spawn Locations"), STAT_SpawnVolumeValidateSpawnLocations, STATGROUP_SpawnVolume);
+
+static const FCollisionObjectQueryParams& GetOccupancyObjectQueryParams()
+{
+	static FCollisionObjectQueryParams OccupancyObjectQueryParams = []()
+	{
+		FCollisionObjectQueryParams Params;
+		Params.AddObjectTypesToQuery(ECC_Pawn);
+		Params.AddObjectTypesToQuery(ECC_DungeonPawn);
+		Params.AddObjectTypesToQuery(ECC_WorldDynamic);
+		Params.AddObjectTypesToQuery(ECC_PhysicsBody);
+		return Params;
+	}();
+
+	return OccupancyObjectQueryParams;
+}
+
+static FVector2D GetCharacterCapsuleExtent(TSubclassOf<ACoreCharacter> CoreCharacter)
+{
+	const ACoreCharacter* CharacterCDO = CoreCharacter ? CoreCharacter.GetDefaultObject() : nullptr;
+	const UCapsuleComponent* CapsuleComponent = CharacterCDO ? CharacterCDO->GetCapsuleComponent() : nullptr;
+
+	if (!CapsuleComponent)
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	return FVector2D(CapsuleComponent->GetUnscaledCapsuleRadius(), CapsuleComponent->GetUnscaledCapsuleHalfHeight()) * CapsuleComponent->GetRelativeScale3D().GetMax();
+}
+
 ASpawnVolume::ASpawnVolume(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -22,39 +57,66 @@ ASpawnVolume::ASpawnVolume(const FObjectInitializer& ObjectInitializer)
 void ASpawnVolume::BeginPlay()
 {
 	SpawnLocationStatusList.SetNum(WorldSpawnLocationList.Num());
+	ReadySpawnLocationList.Reset(WorldSpawnLocationList.Num());
+	UnvalidatedSpawnLocationCount = WorldSpawnLocationList.Num();
 	
 	Super::BeginPlay();
+
+	if (HasAuthority() && WorldSpawnLocationList.Num() > 0)
+	{
+		//Results of this first pass arrive next frame. Spawns requested before then are tested synchronously in GetSpawnTransform.
+		ValidateSpawnLocations();
+		GetWorldTimerManager().SetTimer(SpawnValidationTimerHandle, this, &ASpawnVolume::ValidateSpawnLocations, SpawnValidationInterval, true);
+	}
+}
+
+void ASpawnVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorldTimerManager().ClearTimer(SpawnValidationTimerHandle);
+
+	Super::EndPlay(EndPlayReason);
 }
 
 bool ASpawnVolume::GetSpawnTransform(TSubclassOf<ACoreCharacter> CoreCharacter, FTransform& SpawnTransform)
 {
-	if (!CoreCharacter || WorldSpawnLocationList.Num() == 0)
+	SCOPE_CYCLE_COUNTER(STAT_SpawnVolumeGetSpawnTransform);
+
+	if (!CoreCharacter)
 	{
 		return false;
 	}
 
-	const ACoreCharacter* CharacterCDO = CoreCharacter.GetDefaultObject();
 	const float WorldTime = GetWorld()->GetTimeSeconds();
+	const FVector2D CharacterExtent = GetCharacterCapsuleExtent(CoreCharacter);
 
-	int32 Index;
-
-	for (Index = WorldSpawnLocationList.Num() - 1; Index >= 0; Index--)
+	int32 Index = INDEX_NONE;
+	while (ReadySpawnLocationList.Num() > 0)
 	{
-		if (!SpawnLocationStatusList[Index].IsAvailable(WorldTime))
-		{
-			continue;
-		}
+		const int32 CandidateIndex = ReadySpawnLocationList[FMath::RandHelper(ReadySpawnLocationList.Num())];
+		RemoveFromReadyList(CandidateIndex);
 
-		if (!GetWorld()->FindTeleportSpot(CharacterCDO, WorldSpawnLocationList[Index].Location, FRotator::ZeroRotator))
+		const FVector2D& CylinderExtent = WorldSpawnLocationList[CandidateIndex].CylinderExtent;
+
+		//Background tests only cover the location's cylinder. Characters that don't fit inside it need their own test.
+		if (CharacterExtent.X > CylinderExtent.X || CharacterExtent.Y > CylinderExtent.Y)
 		{
-			SpawnLocationStatusList[Index].MarkFailureTime(WorldTime);
-			continue;
+			if (!IsSpawnLocationClear(CandidateIndex, CharacterExtent))
+			{
+				SpawnLocationStatusList[CandidateIndex].MarkFailureTime(WorldTime);
+				continue;
+			}
 		}
 
+		Index = CandidateIndex;
 		break;
 	}
 
-	if (!SpawnLocationStatusList.IsValidIndex(Index))
+	if (Index == INDEX_NONE)
+	{
+		Index = FindUnvalidatedSpawnLocation(CharacterExtent);
+	}
+
+	if (Index == INDEX_NONE)
 	{
 		return false;
 	}
@@ -63,6 +125,8 @@ bool ASpawnVolume::GetSpawnTransform(TSubclassOf<ACoreCharacter> CoreCharacter,
 
 	FSpawnLocationStatusData& StatusData = SpawnLocationStatusList[Index];
 	StatusData.MarkUseTime(WorldTime);
+	//We're about to put something here. Treat it as occupied until the next occupancy test says otherwise.
+	StatusData.SetOccupied(true);
 	
 	SpawnTransform.SetLocation(LocationData.Location);
 	FRotator Forward = GetActorRotation();
@@ -75,17 +139,140 @@ bool ASpawnVolume::GetSpawnTransform(TSubclassOf<ACoreCharacter> CoreCharacter,
 
 bool ASpawnVolume::HasAvailableSpawnTransform(TSubclassOf<ACoreCharacter> CoreCharacter) const
 {
+	return ReadySpawnLocationList.Num() > 0 || UnvalidatedSpawnLocationCount > 0;
+}
+
+bool ASpawnVolume::IsSpawnLocationClear(int32 Index, const FVector2D& RequiredExtent) const
+{
+	const FSpawnLocationData& LocationData = WorldSpawnLocationList[Index];
+	const FCollisionShape Shape = FCollisionShape::MakeCapsule(FMath::Max(LocationData.CylinderExtent.X, RequiredExtent.X), FMath::Max(LocationData.CylinderExtent.Y, RequiredExtent.Y));
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SpawnVolumeOccupancy), false, this);
+	return !GetWorld()->OverlapAnyTestByObjectType(LocationData.Location, FQuat::Identity, GetOccupancyObjectQueryParams(), Shape, QueryParams);
+}
+
+int32 ASpawnVolume::FindUnvalidatedSpawnLocation(const FVector2D& RequiredExtent)
+{
+	if (UnvalidatedSpawnLocationCount <= 0)
+	{
+		return INDEX_NONE;
+	}
+
 	const float WorldTime = GetWorld()->GetTimeSeconds();
 
-	for (const FSpawnLocationStatusData& Status : SpawnLocationStatusList)
+	for (int32 Index = 0; Index < SpawnLocationStatusList.Num(); Index++)
 	{
-		if (Status.IsAvailable(WorldTime))
+		FSpawnLocationStatusData& StatusData = SpawnLocationStatusList[Index];
+
+		if (StatusData.HasBeenValidated() || !StatusData.IsAvailable(WorldTime))
 		{
-			return true;
+			continue;
 		}
+
+		if (IsSpawnLocationClear(Index, RequiredExtent))
+		{
+			return Index;
+		}
+
+		StatusData.MarkFailureTime(WorldTime);
 	}
 
-	return false;
+	return INDEX_NONE;
+}
+
+void ASpawnVolume::ValidateSpawnLocations()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpawnVolumeValidateSpawnLocations);
+
+	UWorld* World = GetWorld();
+
+	if (!World)
+	{
+		return;
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SpawnVolumeOccupancy), false, this);
+	const float WorldTime = World->GetTimeSeconds();
+
+	for (int32 Index = WorldSpawnLocationList.Num() - 1; Index >= 0; Index--)
+	{
+		FSpawnLocationStatusData& StatusData = SpawnLocationStatusList[Index];
+
+		if (StatusData.IsValidationPending())
+		{
+			continue;
+		}
+
+		//No point in testing a location that couldn't be used anyways.
+		if (!StatusData.IsAvailable(WorldTime))
+		{
+			RemoveFromReadyList(Index);
+			continue;
+		}
+
+		const FSpawnLocationData& LocationData = WorldSpawnLocationList[Index];
+		const FCollisionShape Shape = FCollisionShape::MakeCapsule(LocationData.CylinderExtent.X, LocationData.CylinderExtent.Y);
+
+		StatusData.SetValidationPending(true);
+		World->AsyncOverlapByObjectType(LocationData.Location, FQuat::Identity, GetOccupancyObjectQueryParams(), Shape, QueryParams,
+			FOverlapDelegate::CreateUObject(this, &ASpawnVolume::OnSpawnLocationValidated, Index));
+	}
+}
+
+void ASpawnVolume::OnSpawnLocationValidated(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapDatum, int32 Index)
+{
+	if (!SpawnLocationStatusList.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	FSpawnLocationStatusData& StatusData = SpawnLocationStatusList[Index];
+	StatusData.SetValidationPending(false);
+
+	if (!StatusData.HasBeenValidated())
+	{
+		StatusData.MarkValidated();
+		UnvalidatedSpawnLocationCount--;
+	}
+
+	StatusData.SetOccupied(OverlapDatum.OutOverlaps.Num() > 0);
+
+	if (StatusData.IsOccupied())
+	{
+		StatusData.MarkFailureTime(GetWorld()->GetTimeSeconds());
+		RemoveFromReadyList(Index);
+		return;
+	}
+
+	if (StatusData.IsAvailable(GetWorld()->GetTimeSeconds()))
+	{
+		AddToReadyList(Index);
+	}
+}
+
+void ASpawnVolume::AddToReadyList(int32 Index)
+{
+	FSpawnLocationStatusData& StatusData = SpawnLocationStatusList[Index];
+
+	if (StatusData.IsInReadyList())
+	{
+		return;
+	}
+
+	StatusData.SetInReadyList(true);
+	ReadySpawnLocationList.Add(Index);
+}
+
+void ASpawnVolume::RemoveFromReadyList(int32 Index)
+{
+	FSpawnLocationStatusData& StatusData = SpawnLocationStatusList[Index];
+
+	if (!StatusData.IsInReadyList())
+	{
+		return;
+	}
+
+	StatusData.SetInReadyList(false);
+	ReadySpawnLocationList.RemoveSingleSwap(Index, false);
 }
 
 #if WITH_EDITOR
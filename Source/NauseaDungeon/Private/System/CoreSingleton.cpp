@@ -4,6 +4,7 @@
 #include "System/CoreSingleton.h"
 #include "Engine/GameInstance.h"
 #include "GameFramework/WorldSettings.h"
+#include "System/GameThreadCommandQueue.h"
 
 UCoreSingleton::UCoreSingleton(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -13,6 +14,8 @@ UCoreSingleton::UCoreSingleton(const FObjectInitializer& ObjectInitializer)
 
 void UCoreSingleton::Tick(float DeltaTime)
 {
+	FGameThreadCommandQueue::Get().Drain(FGameThreadCommandQueue::GetDrainTimeBudget());
+
 	if (GameInstance.IsValid() && GameInstance->GetWorld() && GameInstance->GetWorld()->GetWorldSettings())
 	{
 		DeltaTime *= GameInstance->GetWorld()->GetWorldSettings()->GetEffectiveTimeDilation();
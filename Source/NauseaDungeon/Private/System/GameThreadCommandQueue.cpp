@@ -0,0 +1,75 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "System/GameThreadCommandQueue.h"
+#include "NauseaDungeon.h"
+
+static TAutoConsoleVariable<float> CVarGameThreadCommandBudget(
+	TEXT("Nausea.GameThreadCommandBudget"),
+	1.f,
+	TEXT("Time in milliseconds the game thread command queue may spend running commands each frame."));
+
+DECLARE_STATS_GROUP(TEXT("GameThreadCommandQueue"), STATGROUP_GameThreadCommandQueue, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Drain"), STAT_GameThreadCommandQueueDrain, STATGROUP_GameThreadCommandQueue);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Commands Run"), STAT_GameThreadCommandQueueCommandsRun, STATGROUP_GameThreadCommandQueue);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Commands Remaining"), STAT_GameThreadCommandQueueCommandsRemaining, STATGROUP_GameThreadCommandQueue);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Overflowed Commands"), STAT_GameThreadCommandQueueOverflow, STATGROUP_GameThreadCommandQueue);
+
+FGameThreadCommandQueue& FGameThreadCommandQueue::Get()
+{
+	static FGameThreadCommandQueue GameThreadCommandQueue;
+	return GameThreadCommandQueue;
+}
+
+void FGameThreadCommandQueue::Enqueue(TUniqueFunction<void()>&& Command)
+{
+	if (!Command)
+	{
+		return;
+	}
+
+	if (QueuedCommandCount.Increment() > MaxQueuedCommands)
+	{
+		QueuedCommandCount.Decrement();
+		INC_DWORD_STAT(STAT_GameThreadCommandQueueOverflow);
+		UE_LOG(LogNauseaDungeon, Verbose, TEXT("Game thread command queue is full. Handing command to the task graph instead."));
+		AsyncTask(ENamedThreads::GameThread, MoveTemp(Command));
+		return;
+	}
+
+	CommandQueue.Enqueue(MoveTemp(Command));
+}
+
+int32 FGameThreadCommandQueue::Drain(double TimeBudgetSeconds)
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_GameThreadCommandQueueDrain);
+
+	const double EndTime = FPlatformTime::Seconds() + TimeBudgetSeconds;
+	int32 CommandsRun = 0;
+	TUniqueFunction<void()> Command;
+
+	//Always run at least one command so that a zero budget cannot stall the queue.
+	while (CommandQueue.Dequeue(Command))
+	{
+		QueuedCommandCount.Decrement();
+		Command();
+		Command = nullptr;
+		CommandsRun++;
+
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_GameThreadCommandQueueCommandsRun, CommandsRun);
+	SET_DWORD_STAT(STAT_GameThreadCommandQueueCommandsRemaining, Num());
+	return CommandsRun;
+}
+
+double FGameThreadCommandQueue::GetDrainTimeBudget()
+{
+	return FMath::Max(0.f, CVarGameThreadCommandBudget.GetValueOnGameThread()) * 0.001;
+}
\ No newline at end of file
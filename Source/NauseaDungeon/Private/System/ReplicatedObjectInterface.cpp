@@ -4,6 +4,35 @@
 #include "System/ReplicatedObjectInterface.h"
 #include "Engine/ActorChannel.h"
 
+static TAutoConsoleVariable<float> CVarReplicationDirtyGenerationHeartbeat(
+	TEXT("Nausea.ReplicationDirtyGenerationHeartbeat"),
+	0.5f,
+	TEXT("Seconds after which an object using replication dirty generations is replicated to a channel even if it was not marked dirty. Covers resending of lost data and changes in replication conditions. Set to 0 to disable skipping entirely."));
+
+//Blueprint declared replicated properties are never push model so changes to them can't be tracked by dirty generations.
+static bool HasUntrackedReplicatedProperties(const UClass* Class)
+{
+	static TMap<TWeakObjectPtr<const UClass>, bool> UntrackedReplicatedPropertiesCache;
+
+	if (const bool* bCachedResult = UntrackedReplicatedPropertiesCache.Find(Class))
+	{
+		return *bCachedResult;
+	}
+
+	bool bHasUntrackedProperties = false;
+	for (TFieldIterator<FProperty> PropertyIterator(Class); PropertyIterator; ++PropertyIterator)
+	{
+		if (PropertyIterator->HasAnyPropertyFlags(CPF_Net) && PropertyIterator->GetOwnerClass()->HasAnyClassFlags(CLASS_CompiledFromBlueprint))
+		{
+			bHasUntrackedProperties = true;
+			break;
+		}
+	}
+
+	UntrackedReplicatedPropertiesCache.Add(Class, bHasUntrackedProperties);
+	return bHasUntrackedProperties;
+}
+
 UReplicatedObjectInterface::UReplicatedObjectInterface(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -80,6 +109,11 @@ bool IReplicatedObjectInterface::ReplicateSubobjectList(UActorChannel* OwnerActo
 		{
 			continue;
 		}
+
+		if (ReplicatedObjectInterface && !ReplicatedObjectInterface->ShouldReplicateForChannel(OwnerActorChannel))
+		{
+			continue;
+		}
 		
 		if (ReplicatedObjectInterface)
 		{
@@ -87,6 +121,11 @@ bool IReplicatedObjectInterface::ReplicateSubobjectList(UActorChannel* OwnerActo
 		}
 
 		bWroteSomething = OwnerActorChannel->ReplicateSubobject(Subobject, *Bunch, *OwnerRepFlags) || bWroteSomething;
+
+		if (ReplicatedObjectInterface)
+		{
+			ReplicatedObjectInterface->NotifyReplicatedForChannel(OwnerActorChannel);
+		}
 	}
 
 	OwnerRepFlags->bNetInitial = bOwnerCachedNetInitial;
@@ -112,6 +151,13 @@ bool IReplicatedObjectInterface::RegisterReplicatedSubobject(UObject* Subobject)
 	}
 
 	ReplicatedObjectInterfaceSubobjectList.Add(Subobject);
+
+	if (HasUntrackedReplicatedProperties(Subobject->GetClass()))
+	{
+		bReplicatedObjectInterfaceHasUntrackedSubobject = true;
+	}
+
+	MarkReplicationDirty();
 	return true;
 }
 
@@ -119,6 +165,7 @@ bool IReplicatedObjectInterface::UnregisterReplicatedSubobject(UObject* Subobjec
 {
 	ReplicatedObjectInterfaceSubobjectList.Remove(Subobject);
 	ReplicatedObjectInterfaceSubobjectList.Remove(nullptr);
+	MarkReplicationDirty();
 	return true;
 }
 
@@ -126,4 +173,84 @@ bool IReplicatedObjectInterface::ClearReplicatedSubobjectList()
 {
 	ReplicatedObjectInterfaceSubobjectList.Reset();
 	return true;
+}
+
+bool IReplicatedObjectInterface::UsesReplicationDirtyGeneration() const
+{
+	return bReplicatedObjectInterfaceUseDirtyGeneration && !bReplicatedObjectInterfaceHasUntrackedSubobject
+		&& !HasUntrackedReplicatedProperties(CastChecked<UObject>(this)->GetClass());
+}
+
+void IReplicatedObjectInterface::MarkReplicationDirty()
+{
+	ReplicatedObjectInterfaceDirtyGeneration++;
+
+	for (UObject* Outer = CastChecked<UObject>(this)->GetOuter(); Outer && !Outer->IsA<AActor>(); Outer = Outer->GetOuter())
+	{
+		if (IReplicatedObjectInterface* OuterReplicatedObjectInterface = Cast<IReplicatedObjectInterface>(Outer))
+		{
+			OuterReplicatedObjectInterface->MarkReplicationDirty();
+			return;
+		}
+	}
+}
+
+void IReplicatedObjectInterface::MarkObjectReplicationDirty(UObject* Object)
+{
+	if (IReplicatedObjectInterface* ReplicatedObjectInterface = Cast<IReplicatedObjectInterface>(Object))
+	{
+		ReplicatedObjectInterface->MarkReplicationDirty();
+	}
+}
+
+bool IReplicatedObjectInterface::ShouldReplicateForChannel(UActorChannel* OwnerActorChannel) const
+{
+	const float HeartbeatTime = CVarReplicationDirtyGenerationHeartbeat.GetValueOnGameThread();
+
+	if (HeartbeatTime <= 0.f || !UsesReplicationDirtyGeneration())
+	{
+		return true;
+	}
+
+	const FReplicatedObjectChannelRecord* ChannelRecord = ReplicatedObjectInterfaceChannelRecordMap.Find(OwnerActorChannel);
+
+	if (!ChannelRecord || ChannelRecord->DirtyGeneration != ReplicatedObjectInterfaceDirtyGeneration)
+	{
+		return true;
+	}
+
+	//Has not been replicated to this channel yet.
+	if (!OwnerActorChannel->ReplicationMap.Contains(CastChecked<UObject>(this)))
+	{
+		return true;
+	}
+
+	return FPlatformTime::Seconds() - ChannelRecord->LastReplicationTime >= HeartbeatTime;
+}
+
+void IReplicatedObjectInterface::NotifyReplicatedForChannel(UActorChannel* OwnerActorChannel)
+{
+	if (!UsesReplicationDirtyGeneration())
+	{
+		return;
+	}
+
+	FReplicatedObjectChannelRecord* ChannelRecord = ReplicatedObjectInterfaceChannelRecordMap.Find(OwnerActorChannel);
+
+	if (!ChannelRecord)
+	{
+		//Closed channels are cleaned up whenever a new one is added.
+		for (auto It = ReplicatedObjectInterfaceChannelRecordMap.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		ChannelRecord = &ReplicatedObjectInterfaceChannelRecordMap.Add(OwnerActorChannel);
+	}
+
+	ChannelRecord->DirtyGeneration = ReplicatedObjectInterfaceDirtyGeneration;
+	ChannelRecord->LastReplicationTime = FPlatformTime::Seconds();
 }
\ No newline at end of file
@@ -6,6 +6,12 @@
 #include "System/CoreGameMode.h"
 #include "Character/CoreCharacter.h"
 
+DECLARE_STATS_GROUP(TEXT("SpawnCharacterSystem"), STATGROUP_SpawnCharacterSystem, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Perform Next Spawn"), STAT_SpawnCharacterSystemPerformNextSpawn, STATGROUP_SpawnCharacterSystem);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Spawn Requests"), STAT_SpawnCharacterSystemPendingRequests, STATGROUP_SpawnCharacterSystem);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawned Characters"), STAT_SpawnCharacterSystemSpawnedCharacters, STATGROUP_SpawnCharacterSystem);
+
 bool FSpawnRequest::IsValid() const
 {
 	if (!CharacterClass && !SpawnDelegate.IsBound())
@@ -101,6 +107,7 @@ int32 USpawnCharacterSystem::CancelAllRequests(const UObject* WorldContextObject
 bool USpawnCharacterSystem::AddRequest(FSpawnRequest&& SpawnRequest)
 {
 	CharacterSpawnRequestList.Add(MoveTemp(SpawnRequest));
+	SET_DWORD_STAT(STAT_SpawnCharacterSystemPendingRequests, CharacterSpawnRequestList.Num());
 
 	if (GetWorld()->GetTimerManager().IsTimerActive(SpawnTimerHandle))
 	{
@@ -122,18 +129,13 @@ bool USpawnCharacterSystem::AddRequest(FSpawnRequest&& SpawnRequest)
 
 int32 USpawnCharacterSystem::CancelRequestForObject(const UObject* OwningObject)
 {
-	int32 NumCancelled = 0;
-	for (int32 Index = CharacterSpawnRequestList.Num() - 1; Index >= 0; Index--)
-	{
-		if (!CharacterSpawnRequestList[Index].IsOwnedBy(OwningObject))
+	//Single compacting pass that keeps the remaining requests in order.
+	const int32 NumCancelled = CharacterSpawnRequestList.RemoveAll([OwningObject](const FSpawnRequest& Request)
 		{
-			continue;
-		}
-
-		NumCancelled++;
-		CharacterSpawnRequestList.RemoveAt(Index, 0, false);
-	}
+			return Request.IsOwnedBy(OwningObject);
+		});
 
+	SET_DWORD_STAT(STAT_SpawnCharacterSystemPendingRequests, CharacterSpawnRequestList.Num());
 	return NumCancelled;
 }
 
@@ -141,11 +143,14 @@ int32 USpawnCharacterSystem::CancelAllRequests()
 {
 	const int32 NumRequests = CharacterSpawnRequestList.Num();
 	CharacterSpawnRequestList.Reset();
+	SET_DWORD_STAT(STAT_SpawnCharacterSystemPendingRequests, 0);
 	return NumRequests;
 }
 
 void USpawnCharacterSystem::PerformNextSpawn()
 {
+	SCOPE_CYCLE_COUNTER(STAT_SpawnCharacterSystemPerformNextSpawn);
+
 	GetWorld()->GetTimerManager().ClearTimer(SpawnTimerHandle);
 
 	if (CharacterSpawnRequestList.Num() <= 0 || !GetWorld())
@@ -179,6 +184,11 @@ void USpawnCharacterSystem::PerformNextSpawn()
 
 		ACoreCharacter* Character = GetWorld()->SpawnActor<ACoreCharacter>(SpawnClass, SpawnTransform, ActorSpawnParams);
 
+		if (Character)
+		{
+			INC_DWORD_STAT(STAT_SpawnCharacterSystemSpawnedCharacters);
+		}
+
 		//If this broadcast was unhandled, manually notify the game mode of this spawn ourselves (otherwise expect the binding to handle it).
 		if (!Request->BroadcastRequestResult(Character))
 		{
@@ -190,6 +200,8 @@ void USpawnCharacterSystem::PerformNextSpawn()
 		CharacterSpawnRequestList.RemoveAt(0, 1, false);
 	}
 
+	SET_DWORD_STAT(STAT_SpawnCharacterSystemPendingRequests, CharacterSpawnRequestList.Num());
+
 	if (CharacterSpawnRequestList.Num() <= 0)
 	{
 		return;
@@ -0,0 +1,109 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Tests/PerformanceBenchmark.h"
+#include "Gameplay/Ability/AbilityTypes.h"
+#include "UObject/CoreNet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	FAbilityTargetDataContainer BuildBenchmarkTargetData(int32 Count, ETargetDataQuantization Quantization)
+	{
+		FRandomStream RandomStream(1337);
+
+		TArray<FAbilityTargetData> TargetDataList;
+		TargetDataList.Reserve(Count);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			const FVector Location = RandomStream.VRand() * RandomStream.FRandRange(0.f, 4000.f);
+			const FRotator Rotation = FRotator(0.f, RandomStream.FRandRange(-180.f, 180.f), 0.f);
+			TargetDataList.Add(FAbilityTargetData::GenerateTargetLocationData(FTransform(Rotation, Location)));
+		}
+
+		FAbilityTargetDataContainer Container = FAbilityTargetDataContainer(TargetDataList);
+		Container.SetQuantization(Quantization);
+		return Container;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbilityTargetDataNetSerializePerformanceTest, "Nausea.Performance.Ability.TargetDataNetSerialize", NAUSEA_PERFORMANCE_TEST_FLAGS)
+bool FAbilityTargetDataNetSerializePerformanceTest::RunTest(const FString& Parameters)
+{
+	auto MeasureRoundTrip = [this](int32 Count, ETargetDataQuantization Quantization)
+	{
+		FAbilityTargetDataContainer SourceContainer = BuildBenchmarkTargetData(Count, Quantization);
+		FAbilityTargetDataContainer ReceivedContainer;
+		bool bSuccess = true;
+
+		const double Microseconds = NauseaPerformance::MeasureMicroseconds(32, 9, [&SourceContainer, &ReceivedContainer, &bSuccess]()
+		{
+			FNetBitWriter Writer(nullptr, 1 << 20);
+			SourceContainer.NetSerialize(Writer, nullptr, bSuccess);
+
+			FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+			ReceivedContainer.NetSerialize(Reader, nullptr, bSuccess);
+		});
+
+		TestTrue(TEXT("Target data round trip succeeded"), bSuccess);
+		TestEqual(TEXT("Target data round trip count"), ReceivedContainer.GetTargetDataList().Num(), Count);
+		return Microseconds;
+	};
+
+	constexpr int32 SmallCount = 16;
+	constexpr int32 LargeCount = FAbilityTargetDataContainer::MaxReplicatedTargetDataCount;
+
+	const double FullPrecisionMicroseconds = MeasureRoundTrip(LargeCount, ETargetDataQuantization::None);
+	const double SmallQuantizedMicroseconds = MeasureRoundTrip(SmallCount, ETargetDataQuantization::Medium);
+	const double LargeQuantizedMicroseconds = MeasureRoundTrip(LargeCount, ETargetDataQuantization::Medium);
+
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("Ability.TargetDataNetSerialize.None"), FullPrecisionMicroseconds / double(LargeCount));
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("Ability.TargetDataNetSerialize.Medium"), LargeQuantizedMicroseconds / double(LargeCount));
+	NauseaPerformance::TestScaling(*this, TEXT("Ability.TargetDataNetSerialize"), SmallCount, SmallQuantizedMicroseconds, LargeCount, LargeQuantizedMicroseconds);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAbilityTargetDataCachePerformanceTest, "Nausea.Performance.Ability.TargetDataCacheUpdate", NAUSEA_PERFORMANCE_TEST_FLAGS)
+bool FAbilityTargetDataCachePerformanceTest::RunTest(const FString& Parameters)
+{
+	//Mirrors the client side of the target data lifecycle: each update replaces half of the list and diffs it against the previous one.
+	auto MeasureCacheUpdate = [this](int32 Count)
+	{
+		const FAbilityTargetDataContainer FirstContainer = BuildBenchmarkTargetData(Count, ETargetDataQuantization::None);
+		const FAbilityTargetDataContainer SecondContainer = BuildBenchmarkTargetData(Count, ETargetDataQuantization::None);
+
+		TArray<FAbilityTargetData> MixedTargetDataList;
+		MixedTargetDataList.Append(FirstContainer.GetTargetDataList().GetData(), Count / 2);
+		MixedTargetDataList.Append(SecondContainer.GetTargetDataList().GetData() + (Count / 2), Count - (Count / 2));
+
+		FAbilityTargetDataContainer Container = FirstContainer;
+		TArray<FAbilityTargetData> AddedTargetData;
+		TArray<FAbilityTargetData> RemovedTargetData;
+		int32 ChangeCount = 0;
+
+		const double Microseconds = NauseaPerformance::MeasureMicroseconds(32, 9, [&]()
+		{
+			Container.GetTargetDataList() = (ChangeCount & 1) ? FirstContainer.GetTargetDataList() : MixedTargetDataList;
+			AddedTargetData.Reset();
+			RemovedTargetData.Reset();
+			Container.UpdateTargetDataCache(AddedTargetData, RemovedTargetData);
+			ChangeCount++;
+		});
+
+		TestEqual(TEXT("Target data cache reports replaced entries as added"), AddedTargetData.Num(), RemovedTargetData.Num());
+		return Microseconds;
+	};
+
+	constexpr int32 SmallCount = 16;
+	constexpr int32 LargeCount = FAbilityTargetDataContainer::MaxReplicatedTargetDataCount;
+
+	const double SmallMicroseconds = MeasureCacheUpdate(SmallCount);
+	const double LargeMicroseconds = MeasureCacheUpdate(LargeCount);
+
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("Ability.TargetDataCacheUpdate"), LargeMicroseconds / double(LargeCount));
+	NauseaPerformance::TestScaling(*this, TEXT("Ability.TargetDataCacheUpdate"), SmallCount, SmallMicroseconds, LargeCount, LargeMicroseconds);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,34 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NauseaAutomation
+{
+	//Minimal game world with its own world context so that world-bound objects have a timer manager to schedule against.
+	struct FScopedTestWorld
+	{
+		FScopedTestWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+		}
+
+		~FScopedTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		UWorld* World = nullptr;
+	};
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,128 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "System/GameThreadCommandQueue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define GAME_THREAD_COMMAND_QUEUE_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameThreadCommandQueueOrderTest, "Nausea.System.GameThreadCommandQueue.Order", GAME_THREAD_COMMAND_QUEUE_TEST_FLAGS)
+bool FGameThreadCommandQueueOrderTest::RunTest(const FString& Parameters)
+{
+	FGameThreadCommandQueue CommandQueue;
+	TArray<int32> RunOrder;
+
+	constexpr int32 CommandCount = 100;
+	for (int32 Index = 0; Index < CommandCount; Index++)
+	{
+		CommandQueue.Enqueue([&RunOrder, Index]() { RunOrder.Add(Index); });
+	}
+
+	TestEqual(TEXT("Queued command count"), CommandQueue.Num(), CommandCount);
+	TestEqual(TEXT("Commands run"), CommandQueue.Drain(MAX_dbl), CommandCount);
+	TestEqual(TEXT("Queue is empty after draining"), CommandQueue.Num(), 0);
+
+	bool bInOrder = RunOrder.Num() == CommandCount;
+	for (int32 Index = 0; bInOrder && Index < RunOrder.Num(); Index++)
+	{
+		bInOrder = RunOrder[Index] == Index;
+	}
+
+	TestTrue(TEXT("Commands run in FIFO order"), bInOrder);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameThreadCommandQueueProducerTest, "Nausea.System.GameThreadCommandQueue.MultipleProducers", GAME_THREAD_COMMAND_QUEUE_TEST_FLAGS)
+bool FGameThreadCommandQueueProducerTest::RunTest(const FString& Parameters)
+{
+	FGameThreadCommandQueue CommandQueue;
+
+	constexpr int32 ProducerCount = 8;
+	constexpr int32 CommandsPerProducer = 256;
+	static_assert(ProducerCount * CommandsPerProducer <= FGameThreadCommandQueue::GetMaxQueuedCommands(), "Producer test must not overflow the queue.");
+
+	TArray<TArray<int32>> ProducerRunOrder;
+	ProducerRunOrder.SetNum(ProducerCount);
+
+	ParallelFor(ProducerCount, [&CommandQueue, &ProducerRunOrder](int32 ProducerIndex)
+	{
+		for (int32 Index = 0; Index < CommandsPerProducer; Index++)
+		{
+			CommandQueue.Enqueue([&ProducerRunOrder, ProducerIndex, Index]() { ProducerRunOrder[ProducerIndex].Add(Index); });
+		}
+	});
+
+	TestEqual(TEXT("Commands run"), CommandQueue.Drain(MAX_dbl), ProducerCount * CommandsPerProducer);
+
+	//Commands from different producers may interleave, but each producer's commands must keep their relative order.
+	for (int32 ProducerIndex = 0; ProducerIndex < ProducerCount; ProducerIndex++)
+	{
+		const TArray<int32>& RunOrder = ProducerRunOrder[ProducerIndex];
+		bool bInOrder = RunOrder.Num() == CommandsPerProducer;
+		for (int32 Index = 0; bInOrder && Index < RunOrder.Num(); Index++)
+		{
+			bInOrder = RunOrder[Index] == Index;
+		}
+
+		TestTrue(FString::Printf(TEXT("Producer %d commands run in order"), ProducerIndex), bInOrder);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameThreadCommandQueueBudgetTest, "Nausea.System.GameThreadCommandQueue.Budget", GAME_THREAD_COMMAND_QUEUE_TEST_FLAGS)
+bool FGameThreadCommandQueueBudgetTest::RunTest(const FString& Parameters)
+{
+	FGameThreadCommandQueue CommandQueue;
+	int32 RunCount = 0;
+
+	constexpr int32 CommandCount = 20;
+	for (int32 Index = 0; Index < CommandCount; Index++)
+	{
+		CommandQueue.Enqueue([&RunCount]()
+		{
+			RunCount++;
+			FPlatformProcess::Sleep(0.002f);
+		});
+	}
+
+	//A zero budget still makes progress.
+	TestEqual(TEXT("Zero budget runs one command"), CommandQueue.Drain(0.0), 1);
+
+	//Each command takes at least 2ms, so a 5ms budget must stop well before the queue is empty.
+	const int32 BudgetedRunCount = CommandQueue.Drain(0.005);
+	TestTrue(TEXT("Budget stops the drain before the queue is empty"), BudgetedRunCount >= 1 && BudgetedRunCount < CommandCount - 1);
+	TestEqual(TEXT("Remaining commands stay queued"), CommandQueue.Num(), CommandCount - 1 - BudgetedRunCount);
+
+	CommandQueue.Drain(MAX_dbl);
+	TestEqual(TEXT("Every command eventually runs"), RunCount, CommandCount);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameThreadCommandQueueOverflowTest, "Nausea.System.GameThreadCommandQueue.Overflow", GAME_THREAD_COMMAND_QUEUE_TEST_FLAGS)
+bool FGameThreadCommandQueueOverflowTest::RunTest(const FString& Parameters)
+{
+	FGameThreadCommandQueue CommandQueue;
+	int32 RunCount = 0;
+
+	constexpr int32 OverflowCount = 16;
+	constexpr int32 CommandCount = FGameThreadCommandQueue::GetMaxQueuedCommands() + OverflowCount;
+	for (int32 Index = 0; Index < CommandCount; Index++)
+	{
+		CommandQueue.Enqueue([&RunCount]() { RunCount++; });
+	}
+
+	TestEqual(TEXT("Queue is bounded"), CommandQueue.Num(), FGameThreadCommandQueue::GetMaxQueuedCommands());
+	TestEqual(TEXT("Bounded commands run on drain"), CommandQueue.Drain(MAX_dbl), FGameThreadCommandQueue::GetMaxQueuedCommands());
+
+	//Overflowed commands were handed to the task graph's game thread queue rather than dropped.
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	TestEqual(TEXT("Overflowed commands are not dropped"), RunCount, CommandCount);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
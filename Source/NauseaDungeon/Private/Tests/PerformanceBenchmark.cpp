@@ -0,0 +1,124 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Tests/PerformanceBenchmark.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NauseaPerformance
+{
+	static const TCHAR* SettingsSection = TEXT("Settings");
+	static const TCHAR* BaselineSection = TEXT("Baselines");
+
+	static const FConfigFile& GetBaselineConfig()
+	{
+		static FConfigFile BaselineConfig = []()
+		{
+			FConfigFile ConfigFile;
+			ConfigFile.Read(FPaths::Combine(FPaths::ProjectConfigDir(), TEXT("PerformanceBaselines.ini")));
+			return ConfigFile;
+		}();
+
+		return BaselineConfig;
+	}
+
+	static double GetSetting(const TCHAR* Key, double DefaultValue)
+	{
+		FString Value;
+		return GetBaselineConfig().GetString(SettingsSection, Key, Value) ? FCString::Atod(*Value) : DefaultValue;
+	}
+
+	static bool IsRecordingBaseline()
+	{
+		static const bool bRecordBaseline = FParse::Param(FCommandLine::Get(), TEXT("RecordPerformanceBaseline"));
+		return bRecordBaseline;
+	}
+
+	double MeasureMicroseconds(int32 IterationCount, int32 SampleCount, TFunctionRef<void()> Body)
+	{
+		IterationCount = FMath::Max(IterationCount, 1);
+		SampleCount = FMath::Max(SampleCount, 1);
+
+		//Warm caches and any lazily built state before sampling.
+		Body();
+
+		TArray<double> SampleList;
+		SampleList.Reserve(SampleCount);
+
+		for (int32 SampleIndex = 0; SampleIndex < SampleCount; SampleIndex++)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < IterationCount; Iteration++)
+			{
+				Body();
+			}
+			SampleList.Add(((FPlatformTime::Seconds() - StartTime) * 1000000.0) / double(IterationCount));
+		}
+
+		SampleList.Sort();
+		return SampleList[SampleList.Num() / 2];
+	}
+
+	bool TestAgainstBaseline(FAutomationTestBase& Test, const FString& BenchmarkName, double MeasuredMicroseconds)
+	{
+		if (IsRecordingBaseline())
+		{
+			Test.AddInfo(FString::Printf(TEXT("%s=%.4f"), *BenchmarkName, MeasuredMicroseconds));
+			return true;
+		}
+
+		FString BaselineString;
+		if (!GetBaselineConfig().GetString(BaselineSection, *BenchmarkName, BaselineString))
+		{
+			Test.AddWarning(FString::Printf(TEXT("No performance baseline for %s (measured %.4fus)."), *BenchmarkName, MeasuredMicroseconds));
+			return true;
+		}
+
+		const double BaselineMicroseconds = FCString::Atod(*BaselineString);
+		const double Tolerance = GetSetting(TEXT("Tolerance"), 0.5);
+		const double AllowedMicroseconds = BaselineMicroseconds * (1.0 + Tolerance);
+
+		Test.AddInfo(FString::Printf(TEXT("%s: %.4fus (baseline %.4fus)"), *BenchmarkName, MeasuredMicroseconds, BaselineMicroseconds));
+
+#if UE_BUILD_DEBUG
+		//Baselines are recorded against optimized builds.
+		return true;
+#else
+		if (MeasuredMicroseconds > AllowedMicroseconds)
+		{
+			Test.AddError(FString::Printf(TEXT("%s regressed: %.4fus exceeds baseline %.4fus by more than %.0f%%."), *BenchmarkName, MeasuredMicroseconds, BaselineMicroseconds, Tolerance * 100.0));
+			return false;
+		}
+
+		return true;
+#endif
+	}
+
+	bool TestScaling(FAutomationTestBase& Test, const FString& BenchmarkName, int32 SmallCount, double SmallMicroseconds, int32 LargeCount, double LargeMicroseconds)
+	{
+		if (SmallCount <= 0 || LargeCount <= 0 || SmallMicroseconds <= 0.0)
+		{
+			return true;
+		}
+
+		const double SmallCostPerElement = SmallMicroseconds / double(SmallCount);
+		const double LargeCostPerElement = LargeMicroseconds / double(LargeCount);
+		const double ScalingRatio = LargeCostPerElement / SmallCostPerElement;
+		const double MaxScalingRatio = GetSetting(TEXT("MaxScalingRatio"), 3.0);
+
+		Test.AddInfo(FString::Printf(TEXT("%s: per-element cost x%.2f going from %d to %d elements."), *BenchmarkName, ScalingRatio, SmallCount, LargeCount));
+
+		if (ScalingRatio > MaxScalingRatio)
+		{
+			Test.AddError(FString::Printf(TEXT("%s scales superlinearly: per-element cost grew x%.2f going from %d to %d elements (allowed x%.2f)."), *BenchmarkName, ScalingRatio, SmallCount, LargeCount, MaxScalingRatio));
+			return false;
+		}
+
+		return true;
+	}
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,30 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define NAUSEA_PERFORMANCE_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/**
+ * Helpers shared by the Nausea.Performance automation tests.
+ * Timings are compared against Config/PerformanceBaselines.ini. Run the tests with -RecordPerformanceBaseline to print
+ * fresh values for that file instead of failing on regressions.
+ */
+namespace NauseaPerformance
+{
+	//Runs Body IterationCount times per sample and returns the median time of a single iteration in microseconds.
+	double MeasureMicroseconds(int32 IterationCount, int32 SampleCount, TFunctionRef<void()> Body);
+
+	//Fails the test if MeasuredMicroseconds exceeds the stored baseline by more than the configured tolerance.
+	bool TestAgainstBaseline(FAutomationTestBase& Test, const FString& BenchmarkName, double MeasuredMicroseconds);
+
+	//Fails the test if the per-element cost at LargeCount grew by more than the configured scaling ratio compared to SmallCount.
+	//Catches accidental superlinear behaviour independently of how fast the machine running the test is.
+	bool TestScaling(FAutomationTestBase& Test, const FString& BenchmarkName, int32 SmallCount, double SmallMicroseconds, int32 LargeCount, double LargeMicroseconds);
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Tests/PerformanceBenchmark.h"
+#include "Overlord/PlacementTypes.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	//Builds a fully populated grid where roughly OccupiedFraction of the points are occupied.
+	void BuildBenchmarkGrid(FPlacementGrid& Grid, int32 SizeX, int32 SizeY, float OccupiedFraction, int32 Seed)
+	{
+		Grid.Reset();
+		Grid.SetRootTransform(FTransform(FVector(0.f, 0.f, 100.f)));
+
+		for (int32 Y = 0; Y < SizeY; Y++)
+		{
+			for (int32 X = 0; X < SizeX; X++)
+			{
+				Grid.Set(X, Y, FPlacementPoint(FPlacementHandle::GenerateHandle(), FPlacementCoordinates(X, Y)));
+			}
+		}
+
+		Grid.RecalculateHandleMap();
+
+		FRandomStream RandomStream(Seed);
+		for (int32 Y = 0; Y < SizeY; Y++)
+		{
+			for (int32 X = 0; X < SizeX; X++)
+			{
+				if (RandomStream.FRand() < OccupiedFraction)
+				{
+					Grid.SetOccupant(X, Y, GetTransientPackage());
+				}
+			}
+		}
+	}
+
+	void BuildQueryList(TArray<FPlacementCoordinates>& QueryList, int32 SizeX, int32 SizeY, int32 Count, int32 Seed)
+	{
+		FRandomStream RandomStream(Seed);
+		QueryList.Reset(Count);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			QueryList.Add(FPlacementCoordinates(RandomStream.RandHelper(SizeX), RandomStream.RandHelper(SizeY)));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementGridIsValidPlacementPerformanceTest, "Nausea.Performance.PlacementGrid.IsValidPlacement", NAUSEA_PERFORMANCE_TEST_FLAGS)
+bool FPlacementGridIsValidPlacementPerformanceTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 QueryCount = 1024;
+
+	auto MeasureGrid = [](int32 SizeX, int32 SizeY)
+	{
+		FPlacementGrid Grid;
+		BuildBenchmarkGrid(Grid, SizeX, SizeY, 0.25f, 1337);
+
+		TArray<FPlacementCoordinates> QueryList;
+		BuildQueryList(QueryList, SizeX, SizeY, QueryCount, 7331);
+
+		int32 ValidCount = 0;
+		const double Microseconds = NauseaPerformance::MeasureMicroseconds(16, 9, [&Grid, &QueryList, &ValidCount]()
+		{
+			for (const FPlacementCoordinates& Coordinates : QueryList)
+			{
+				ValidCount += Grid.IsValidPlacement(Coordinates, 3, 3, true) ? 1 : 0;
+			}
+		});
+
+		return Microseconds / double(QueryCount);
+	};
+
+	const double SmallGridMicroseconds = MeasureGrid(32, 16);
+	const double LargeGridMicroseconds = MeasureGrid(256, 128);
+
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("PlacementGrid.IsValidPlacement"), LargeGridMicroseconds);
+	//A single query should not get more expensive as the grid grows.
+	NauseaPerformance::TestScaling(*this, TEXT("PlacementGrid.IsValidPlacement"), 1, SmallGridMicroseconds, 1, LargeGridMicroseconds);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementGridFindNearestValidPlacementPerformanceTest, "Nausea.Performance.PlacementGrid.FindNearestValidPlacement", NAUSEA_PERFORMANCE_TEST_FLAGS)
+bool FPlacementGridFindNearestValidPlacementPerformanceTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 QueryCount = 256;
+
+	FPlacementGrid Grid;
+	BuildBenchmarkGrid(Grid, 128, 64, 0.5f, 1337);
+
+	TArray<FPlacementCoordinates> QueryList;
+	BuildQueryList(QueryList, 128, 64, QueryCount, 7331);
+
+	int32 FoundCount = 0;
+	const double Microseconds = NauseaPerformance::MeasureMicroseconds(8, 9, [&Grid, &QueryList, &FoundCount]()
+	{
+		FPlacementCoordinates Result;
+		for (const FPlacementCoordinates& Coordinates : QueryList)
+		{
+			FoundCount += Grid.FindNearestValidPlacement(Coordinates, 3, 2, true, 8, Result) ? 1 : 0;
+		}
+	});
+
+	TestTrue(TEXT("Nearest valid placement found for some queries"), FoundCount > 0);
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("PlacementGrid.FindNearestValidPlacement"), Microseconds / double(QueryCount));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlacementGridAvailabilityMaskPerformanceTest, "Nausea.Performance.PlacementGrid.AvailabilityMaskRebuild", NAUSEA_PERFORMANCE_TEST_FLAGS)
+bool FPlacementGridAvailabilityMaskPerformanceTest::RunTest(const FString& Parameters)
+{
+	auto MeasureGrid = [](int32 SizeX, int32 SizeY)
+	{
+		FPlacementGrid Grid;
+		BuildBenchmarkGrid(Grid, SizeX, SizeY, 0.25f, 1337);
+
+		return NauseaPerformance::MeasureMicroseconds(16, 9, [&Grid]()
+		{
+			Grid.MarkAvailabilityDirty();
+			Grid.GetAvailabilityMask(true);
+		});
+	};
+
+	const int32 SmallPointCount = 32 * 16;
+	const int32 LargePointCount = 256 * 128;
+	const double SmallGridMicroseconds = MeasureGrid(32, 16);
+	const double LargeGridMicroseconds = MeasureGrid(256, 128);
+
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("PlacementGrid.AvailabilityMaskRebuild"), LargeGridMicroseconds);
+	NauseaPerformance::TestScaling(*this, TEXT("PlacementGrid.AvailabilityMaskRebuild"), SmallPointCount, SmallGridMicroseconds, LargePointCount, LargeGridMicroseconds);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,48 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Tests/AutomationTestWorld.h"
+#include "System/SpawnCharacterSystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define SPAWN_CHARACTER_SYSTEM_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpawnCharacterSystemCancelRequestTest, "Nausea.System.SpawnCharacterSystem.CancelRequestForObject", SPAWN_CHARACTER_SYSTEM_TEST_FLAGS)
+bool FSpawnCharacterSystemCancelRequestTest::RunTest(const FString& Parameters)
+{
+	NauseaAutomation::FScopedTestWorld TestWorld;
+
+	USpawnCharacterSystem* SpawnCharacterSystem = NewObject<USpawnCharacterSystem>(TestWorld.World);
+	UObject* CancelledOwner = NewObject<USpawnCharacterSystem>(TestWorld.World);
+	UObject* KeptOwner = NewObject<USpawnCharacterSystem>(TestWorld.World);
+
+	//Interleave owners so that cancelled requests sit between the ones that must survive. Each request's X location records its queue order.
+	constexpr int32 RequestCount = 10;
+	for (int32 Index = 0; Index < RequestCount; Index++)
+	{
+		UObject* Owner = Index % 2 == 0 ? CancelledOwner : KeptOwner;
+		FCharacterSpawnRequestDelegate Delegate = FCharacterSpawnRequestDelegate::CreateWeakLambda(Owner, [](const FSpawnRequest&, ACoreCharacter*) {});
+		SpawnCharacterSystem->AddRequest(FSpawnRequest(nullptr, FTransform(FVector(Index, 0.f, 0.f)), FActorSpawnParameters(), MoveTemp(Delegate)));
+	}
+
+	TestEqual(TEXT("Cancelled request count"), SpawnCharacterSystem->CancelRequestForObject(CancelledOwner), RequestCount / 2);
+	TestEqual(TEXT("Remaining request count"), SpawnCharacterSystem->CharacterSpawnRequestList.Num(), RequestCount / 2);
+
+	bool bKeptInOrder = true;
+	for (int32 Index = 0; Index < SpawnCharacterSystem->CharacterSpawnRequestList.Num(); Index++)
+	{
+		const FSpawnRequest& Request = SpawnCharacterSystem->CharacterSpawnRequestList[Index];
+		bKeptInOrder &= Request.IsOwnedBy(KeptOwner) && FMath::IsNearlyEqual(Request.GetTransform().GetLocation().X, float(Index * 2 + 1));
+	}
+
+	TestTrue(TEXT("Remaining requests belong to the other owner and keep their queue order"), bKeptInOrder);
+	TestEqual(TEXT("Cancelling an owner with no requests is a no-op"), SpawnCharacterSystem->CancelRequestForObject(CancelledOwner), 0);
+	TestEqual(TEXT("Cancelling the remaining owner empties the queue"), SpawnCharacterSystem->CancelRequestForObject(KeptOwner), RequestCount / 2);
+	TestEqual(TEXT("Queue is empty"), SpawnCharacterSystem->CharacterSpawnRequestList.Num(), 0);
+
+	TestWorld.World->GetTimerManager().ClearTimer(SpawnCharacterSystem->SpawnTimerHandle);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Tests/PerformanceBenchmark.h"
+#include "System/SpawnCharacterSystem.h"
+#include "Tests/AutomationTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpawnCharacterSystemRequestPerformanceTest, "Nausea.Performance.SpawnCharacterSystem.RequestThroughput", NAUSEA_PERFORMANCE_TEST_FLAGS)
+bool FSpawnCharacterSystemRequestPerformanceTest::RunTest(const FString& Parameters)
+{
+	NauseaAutomation::FScopedTestWorld BenchmarkWorld;
+
+	USpawnCharacterSystem* SpawnCharacterSystem = NewObject<USpawnCharacterSystem>(BenchmarkWorld.World);
+
+	constexpr int32 OwnerCount = 8;
+	TArray<USpawnCharacterSystem*> OwnerList;
+	for (int32 Index = 0; Index < OwnerCount; Index++)
+	{
+		OwnerList.Add(NewObject<USpawnCharacterSystem>(BenchmarkWorld.World));
+	}
+
+	//Queues RequestCount requests spread across several owners, then cancels them owner by owner the way wave and spawner teardown does.
+	auto MeasureRequests = [&](int32 RequestCount)
+	{
+		bool bCancelledAll = true;
+
+		const double Microseconds = NauseaPerformance::MeasureMicroseconds(4, 9, [&]()
+		{
+			for (int32 Index = 0; Index < RequestCount; Index++)
+			{
+				USpawnCharacterSystem* Owner = OwnerList[Index % OwnerCount];
+				FCharacterSpawnRequestDelegate Delegate = FCharacterSpawnRequestDelegate::CreateWeakLambda(Owner, [](const FSpawnRequest&, ACoreCharacter*) {});
+				SpawnCharacterSystem->AddRequest(FSpawnRequest(nullptr, FTransform(FVector(Index, 0.f, 0.f)), FActorSpawnParameters(), MoveTemp(Delegate)));
+			}
+
+			int32 CancelledCount = 0;
+			for (USpawnCharacterSystem* Owner : OwnerList)
+			{
+				CancelledCount += SpawnCharacterSystem->CancelRequestForObject(Owner);
+			}
+
+			bCancelledAll &= CancelledCount == RequestCount && SpawnCharacterSystem->CharacterSpawnRequestList.Num() == 0;
+		});
+
+		TestTrue(TEXT("All spawn requests were cancelled"), bCancelledAll);
+		return Microseconds;
+	};
+
+	constexpr int32 SmallCount = 128;
+	constexpr int32 LargeCount = 2048;
+
+	const double SmallMicroseconds = MeasureRequests(SmallCount);
+	const double LargeMicroseconds = MeasureRequests(LargeCount);
+
+	SpawnCharacterSystem->CancelAllRequests();
+	BenchmarkWorld.World->GetTimerManager().ClearTimer(SpawnCharacterSystem->SpawnTimerHandle);
+
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("SpawnCharacterSystem.RequestThroughput"), LargeMicroseconds / double(LargeCount));
+	NauseaPerformance::TestScaling(*this, TEXT("SpawnCharacterSystem.RequestThroughput"), SmallCount, SmallMicroseconds, LargeCount, LargeMicroseconds);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Tests/PerformanceBenchmark.h"
+#include "Tests/AutomationTestWorld.h"
+#include "Gameplay/StatusComponent.h"
+#include "Gameplay/StatusEffect/StatusEffectBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatusComponentTakeDamagePerformanceTest, "Nausea.Performance.StatusComponent.TakeDamage", NAUSEA_PERFORMANCE_TEST_FLAGS)
+bool FStatusComponentTakeDamagePerformanceTest::RunTest(const FString& Parameters)
+{
+	NauseaAutomation::FScopedTestWorld BenchmarkWorld;
+
+	constexpr float BenchmarkHealth = 1000000000.f;
+	constexpr int32 DamageCount = 64;
+
+	//Each active effect binds a damage taken modifier, which TakeDamage runs through OnProcessDamageTaken on every hit.
+	auto MeasureEffects = [&](int32 EffectCount)
+	{
+		AActor* Actor = BenchmarkWorld.World->SpawnActor<AActor>();
+
+		//Left unregistered so that InitializeComponent does not require the owner to implement IStatusInterface.
+		UStatusComponent* StatusComponent = NewObject<UStatusComponent>(Actor);
+		StatusComponent->bMakeNoiseOnDamage = false;
+		StatusComponent->SetMaxHealth(BenchmarkHealth);
+		StatusComponent->SetHealth(BenchmarkHealth);
+
+		for (int32 Index = 0; Index < EffectCount; Index++)
+		{
+			UStatusEffectBasic* StatusEffect = NewObject<UStatusEffectBasic>(StatusComponent);
+			StatusEffect->Initialize(StatusComponent, nullptr, -1.f, FAISystem::InvalidDirection);
+			StatusEffect->SetStatModifier(EStatusEffectStatModifier::DamageTaken, 0.99f);
+		}
+
+		const FDamageEvent DamageEvent;
+		const double Microseconds = NauseaPerformance::MeasureMicroseconds(4, 9, [&]()
+		{
+			for (int32 Index = 0; Index < DamageCount; Index++)
+			{
+				float DamageAmount = 1.f;
+				StatusComponent->TakeDamage(Actor, DamageAmount, DamageEvent, nullptr, nullptr);
+			}
+		});
+
+		TestFalse(TEXT("Benchmark status component survived"), StatusComponent->IsDead());
+
+		BenchmarkWorld.World->GetTimerManager().ClearAllTimersForObject(StatusComponent);
+		Actor->Destroy();
+		return Microseconds / double(DamageCount);
+	};
+
+	constexpr int32 SmallEffectCount = 4;
+	constexpr int32 LargeEffectCount = 64;
+
+	const double SmallMicroseconds = MeasureEffects(SmallEffectCount);
+	const double LargeMicroseconds = MeasureEffects(LargeEffectCount);
+
+	NauseaPerformance::TestAgainstBaseline(*this, TEXT("StatusComponent.TakeDamage"), LargeMicroseconds);
+	//Per-hit cost should grow at most linearly with the number of active effects.
+	NauseaPerformance::TestScaling(*this, TEXT("StatusComponent.TakeDamage"), SmallEffectCount, SmallMicroseconds, LargeEffectCount, LargeMicroseconds);
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,209 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+
+#include "Tests/AutomationTestWorld.h"
+#include "Overlord/TrapActivationScheduler.h"
+#include "Overlord/TrapBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define TRAP_ACTIVATION_SCHEDULER_TEST_FLAGS (EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+//Drives a scheduler in a scoped test world. World time is only ever set to the middle of a wheel slot so that tick math is not subject to float rounding.
+struct FTrapActivationSchedulerTestHelper
+{
+	FTrapActivationSchedulerTestHelper()
+	{
+		Scheduler = NewObject<UTrapActivationScheduler>(TestWorld.World);
+	}
+
+	~FTrapActivationSchedulerTestHelper()
+	{
+		Scheduler->MarkPendingKill();
+	}
+
+	//Delay that always rounds up to exactly SlotCount slots.
+	static float GetDelayForSlots(int32 SlotCount) { return (float(SlotCount) - 0.5f) * UTrapActivationScheduler::SlotDuration; }
+
+	ATrapBase* SpawnTrap(ETrapTriggerCondition TriggerCondition, int32 InitialDelaySlots, int32 CooldownSlots, int32 TriggerCheckIntervalSlots = 1)
+	{
+		ATrapBase* Trap = TestWorld.World->SpawnActor<ATrapBase>();
+		Trap->ActivationSettings.bUseNativeActivation = true;
+		Trap->ActivationSettings.TriggerCondition = TriggerCondition;
+		Trap->ActivationSettings.InitialDelay = InitialDelaySlots > 0 ? GetDelayForSlots(InitialDelaySlots) : 0.f;
+		Trap->ActivationSettings.Cooldown = GetDelayForSlots(CooldownSlots);
+		Trap->ActivationSettings.TriggerCheckInterval = GetDelayForSlots(TriggerCheckIntervalSlots);
+		return Trap;
+	}
+
+	void SetWorldTick(int64 Tick)
+	{
+		TestWorld.World->TimeSeconds = (float(Tick) + 0.5f) * UTrapActivationScheduler::SlotDuration;
+	}
+
+	void AdvanceToTick(int64 Tick)
+	{
+		SetWorldTick(Tick);
+		Scheduler->Tick(UTrapActivationScheduler::SlotDuration);
+	}
+
+	int64 GetCurrentTick() const { return Scheduler->CurrentTick; }
+
+	//Returns INDEX_NONE if the trap is not registered.
+	int64 GetDueTick(const ATrapBase* Trap) const
+	{
+		const int32* EntryIndex = Scheduler->EntryIndexMap.Find(Trap);
+		return EntryIndex ? Scheduler->EntryList[*EntryIndex].DueTick : INDEX_NONE;
+	}
+
+	int32 GetSlotIndex(const ATrapBase* Trap) const
+	{
+		const int32* EntryIndex = Scheduler->EntryIndexMap.Find(Trap);
+		return EntryIndex ? Scheduler->EntryList[*EntryIndex].SlotIndex : INDEX_NONE;
+	}
+
+	bool IsInSlot(const ATrapBase* Trap, int32 SlotIndex) const
+	{
+		const int32* EntryIndex = Scheduler->EntryIndexMap.Find(Trap);
+		return EntryIndex && Scheduler->Wheel.IsValidIndex(SlotIndex) && Scheduler->Wheel[SlotIndex].Contains(*EntryIndex);
+	}
+
+	int32 GetWheelEntryCount() const
+	{
+		int32 Count = 0;
+		for (const TArray<int32>& Slot : Scheduler->Wheel)
+		{
+			Count += Slot.Num();
+		}
+		return Count;
+	}
+
+	NauseaAutomation::FScopedTestWorld TestWorld;
+	UTrapActivationScheduler* Scheduler = nullptr;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTrapActivationSchedulerSlotPlacementTest, "Nausea.Overlord.TrapActivationScheduler.SlotPlacement", TRAP_ACTIVATION_SCHEDULER_TEST_FLAGS)
+bool FTrapActivationSchedulerSlotPlacementTest::RunTest(const FString& Parameters)
+{
+	FTrapActivationSchedulerTestHelper Helper;
+	Helper.SetWorldTick(10);
+
+	ATrapBase* NearTrap = Helper.SpawnTrap(ETrapTriggerCondition::Periodic, 11, 4);
+	ATrapBase* FarTrap = Helper.SpawnTrap(ETrapTriggerCondition::Periodic, UTrapActivationScheduler::WheelSize + 5, 4);
+	Helper.Scheduler->RegisterTrap(NearTrap);
+	Helper.Scheduler->RegisterTrap(FarTrap);
+
+	TestEqual(TEXT("Wheel starts at the world tick"), Helper.GetCurrentTick(), int64(10));
+	TestEqual(TEXT("Near trap due tick"), Helper.GetDueTick(NearTrap), int64(21));
+	TestTrue(TEXT("Near trap is in its due slot"), Helper.IsInSlot(NearTrap, 21));
+
+	//More than one revolution out wraps around onto an earlier slot.
+	const int64 FarDueTick = 10 + UTrapActivationScheduler::WheelSize + 5;
+	TestEqual(TEXT("Far trap due tick"), Helper.GetDueTick(FarTrap), FarDueTick);
+	TestTrue(TEXT("Far trap is in its wrapped slot"), Helper.IsInSlot(FarTrap, int32(FarDueTick % UTrapActivationScheduler::WheelSize)));
+
+	//Passes over the far trap's slot without its due tick having come around.
+	Helper.AdvanceToTick(20);
+	TestEqual(TEXT("Near trap has not fired early"), Helper.GetDueTick(NearTrap), int64(21));
+	TestEqual(TEXT("Far trap stays scheduled when its slot comes around early"), Helper.GetDueTick(FarTrap), FarDueTick);
+	TestTrue(TEXT("Far trap stays in its wrapped slot"), Helper.IsInSlot(FarTrap, int32(FarDueTick % UTrapActivationScheduler::WheelSize)));
+
+	Helper.AdvanceToTick(21);
+	TestEqual(TEXT("Near trap fired on its due tick"), Helper.GetDueTick(NearTrap), int64(25));
+	TestEqual(TEXT("Far trap is unaffected"), Helper.GetDueTick(FarTrap), FarDueTick);
+
+	Helper.AdvanceToTick(FarDueTick);
+	TestEqual(TEXT("Far trap fired once its due tick came around"), Helper.GetDueTick(FarTrap), FarDueTick + 4);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTrapActivationSchedulerRearmTest, "Nausea.Overlord.TrapActivationScheduler.RearmAfterFire", TRAP_ACTIVATION_SCHEDULER_TEST_FLAGS)
+bool FTrapActivationSchedulerRearmTest::RunTest(const FString& Parameters)
+{
+	FTrapActivationSchedulerTestHelper Helper;
+	Helper.SetWorldTick(100);
+
+	//Periodic traps always activate. Pawn traps without a pawn in range fail their trigger check.
+	ATrapBase* PeriodicTrap = Helper.SpawnTrap(ETrapTriggerCondition::Periodic, 0, 21);
+	ATrapBase* PawnTrap = Helper.SpawnTrap(ETrapTriggerCondition::PawnInRange, 0, 21, 6);
+	Helper.Scheduler->RegisterTrap(PeriodicTrap);
+	Helper.Scheduler->RegisterTrap(PawnTrap);
+
+	TestEqual(TEXT("No initial delay is due on the next tick"), Helper.GetDueTick(PeriodicTrap), int64(101));
+
+	Helper.AdvanceToTick(101);
+	TestEqual(TEXT("Activated trap is re-armed by its cooldown"), Helper.GetDueTick(PeriodicTrap), int64(122));
+	TestTrue(TEXT("Activated trap is back in the wheel"), Helper.IsInSlot(PeriodicTrap, 122));
+	TestEqual(TEXT("Untriggered trap is re-armed by its trigger check interval"), Helper.GetDueTick(PawnTrap), int64(107));
+	TestTrue(TEXT("Untriggered trap is back in the wheel"), Helper.IsInSlot(PawnTrap, 107));
+	TestEqual(TEXT("Every entry is in exactly one slot"), Helper.GetWheelEntryCount(), 2);
+
+	Helper.AdvanceToTick(121);
+	TestEqual(TEXT("Activated trap waits out its cooldown"), Helper.GetDueTick(PeriodicTrap), int64(122));
+
+	Helper.AdvanceToTick(122);
+	TestEqual(TEXT("Activated trap fires again after its cooldown"), Helper.GetDueTick(PeriodicTrap), int64(143));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTrapActivationSchedulerUnregisterTest, "Nausea.Overlord.TrapActivationScheduler.UnregisterMidWheel", TRAP_ACTIVATION_SCHEDULER_TEST_FLAGS)
+bool FTrapActivationSchedulerUnregisterTest::RunTest(const FString& Parameters)
+{
+	FTrapActivationSchedulerTestHelper Helper;
+	Helper.SetWorldTick(0);
+
+	ATrapBase* RemovedTrap = Helper.SpawnTrap(ETrapTriggerCondition::Periodic, 11, 4);
+	ATrapBase* KeptTrap = Helper.SpawnTrap(ETrapTriggerCondition::Periodic, 11, 4);
+	Helper.Scheduler->RegisterTrap(RemovedTrap);
+	Helper.Scheduler->RegisterTrap(KeptTrap);
+
+	Helper.AdvanceToTick(5);
+	Helper.Scheduler->UnregisterTrap(RemovedTrap);
+
+	TestEqual(TEXT("Registered trap count"), Helper.Scheduler->Num(), 1);
+	TestEqual(TEXT("Unregistered trap is no longer scheduled"), Helper.GetDueTick(RemovedTrap), int64(INDEX_NONE));
+	TestTrue(TEXT("Remaining trap keeps its slot"), Helper.IsInSlot(KeptTrap, 11));
+	TestEqual(TEXT("Unregistered trap was removed from its slot"), Helper.GetWheelEntryCount(), 1);
+
+	Helper.AdvanceToTick(11);
+	TestEqual(TEXT("Remaining trap fires on its due tick"), Helper.GetDueTick(KeptTrap), int64(15));
+	TestEqual(TEXT("Unregistered trap was not re-armed"), Helper.GetDueTick(RemovedTrap), int64(INDEX_NONE));
+
+	Helper.Scheduler->UnregisterTrap(KeptTrap);
+	TestEqual(TEXT("Scheduler is empty"), Helper.Scheduler->Num(), 0);
+	TestEqual(TEXT("Wheel is empty"), Helper.GetWheelEntryCount(), 0);
+	TestFalse(TEXT("Empty scheduler does not tick"), Helper.Scheduler->IsTickable());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTrapActivationSchedulerRegisterAfterIdleTest, "Nausea.Overlord.TrapActivationScheduler.RegisterAfterIdle", TRAP_ACTIVATION_SCHEDULER_TEST_FLAGS)
+bool FTrapActivationSchedulerRegisterAfterIdleTest::RunTest(const FString& Parameters)
+{
+	FTrapActivationSchedulerTestHelper Helper;
+	Helper.SetWorldTick(0);
+
+	ATrapBase* FirstTrap = Helper.SpawnTrap(ETrapTriggerCondition::Periodic, 11, 4);
+	Helper.Scheduler->RegisterTrap(FirstTrap);
+	Helper.Scheduler->UnregisterTrap(FirstTrap);
+
+	//The wheel does not tick while it is empty, so its tick falls behind the world clock.
+	Helper.SetWorldTick(5000);
+
+	ATrapBase* LateTrap = Helper.SpawnTrap(ETrapTriggerCondition::Periodic, 11, 4);
+	Helper.Scheduler->RegisterTrap(LateTrap);
+
+	TestEqual(TEXT("Wheel resynced to the world tick"), Helper.GetCurrentTick(), int64(5000));
+	TestEqual(TEXT("Initial delay is measured from registration"), Helper.GetDueTick(LateTrap), int64(5011));
+
+	Helper.AdvanceToTick(5001);
+	TestEqual(TEXT("Trap does not fire on the next tick after idle"), Helper.GetDueTick(LateTrap), int64(5011));
+
+	Helper.AdvanceToTick(5010);
+	TestEqual(TEXT("Trap waits out its initial delay"), Helper.GetDueTick(LateTrap), int64(5011));
+
+	Helper.AdvanceToTick(5011);
+	TestEqual(TEXT("Trap fires once its initial delay has elapsed"), Helper.GetDueTick(LateTrap), int64(5015));
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
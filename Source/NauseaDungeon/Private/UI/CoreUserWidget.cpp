@@ -8,6 +8,7 @@
 #include "Player/PlayerStatistics/PlayerStatisticsComponent.h"
 #include "Player/CorePlayerState.h"
 #include "Character/CoreCharacter.h"
+#include "UI/CoreWidgetComponent.h"
 
 UCoreUserWidget::UCoreUserWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -64,13 +65,35 @@ ACoreCharacter* UCoreUserWidget::GetOwningPlayerCharacter() const
 
 void UCoreUserWidget::ReleaseWidgetToPool()
 {
-	if (ACoreHUD* CoreHUD = GetOwningPlayer() ? GetOwningPlayer()->GetHUD<ACoreHUD>() : nullptr)
+	RemoveFromParent();
+
+	if (ACoreHUD* CoreHUD = GetOwningCoreHUD())
 	{
-		CoreHUD->ReleaseWidgetToPool(this);
+		NativeOnReleasedToPool();
 		OnWidgetReleasedToPool();
+		CoreHUD->ReleaseWidgetToPool(this);
 	}
+}
 
-	RemoveFromParent();
+void UCoreUserWidget::NotifyAcquiredFromPool()
+{
+	NativeOnAcquiredFromPool();
+	OnWidgetAcquiredFromPool();
+}
+
+void UCoreUserWidget::NativeOnReleasedToPool()
+{
+	CoreWidgetComponent = nullptr;
+}
+
+ACoreHUD* UCoreUserWidget::GetOwningCoreHUD() const
+{
+	if (ACoreHUD* CoreHUD = GetOwningPlayer() ? GetOwningPlayer()->GetHUD<ACoreHUD>() : nullptr)
+	{
+		return CoreHUD;
+	}
+
+	return CoreWidgetComponent ? CoreWidgetComponent->GetOwningCoreHUD() : nullptr;
 }
 
 void UCoreUserWidget::InitializeWidgetComponent(UCoreWidgetComponent* InCoreWidgetComponent)
@@ -2,6 +2,10 @@
 
 
 #include "UI/CoreWidgetComponent.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/PlayerController.h"
+#include "UI/CoreUserWidget.h"
+#include "Player/CoreHUD.h"
 
 UCoreWidgetComponent::UCoreWidgetComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -9,12 +13,45 @@ UCoreWidgetComponent::UCoreWidgetComponent(const FObjectInitializer& ObjectIniti
 
 }
 
+void UCoreWidgetComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	UCoreUserWidget* CoreUserWidget = bUseWidgetPool ? Cast<UCoreUserWidget>(GetWidget()) : nullptr;
+
+	//Widget must be released before it is removed from this component so that the pool can hold onto its Slate widget.
+	if (CoreUserWidget && GetOwningCoreHUD())
+	{
+		CoreUserWidget->ReleaseWidgetToPool();
+		SetWidget(nullptr);
+	}
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
 void UCoreWidgetComponent::InitWidget()
 {
+	if (bUseWidgetPool && !GetWidget() && GetWidgetClass() && GetWidgetClass()->IsChildOf(UCoreUserWidget::StaticClass()))
+	{
+		//Super::InitWidget will create a new widget if the pool had nothing for us.
+		if (ACoreHUD* CoreHUD = GetOwningCoreHUD())
+		{
+			if (UCoreUserWidget* PooledWidget = CoreHUD->AcquireWidgetFromPool(GetWidgetClass().Get()))
+			{
+				SetWidget(PooledWidget);
+			}
+		}
+	}
+
 	Super::InitWidget();
 
 	if (UCoreUserWidget* CoreUserWidget = Cast<UCoreUserWidget>(GetWidget()))
 	{
 		CoreUserWidget->InitializeWidgetComponent(this);
 	}
+}
+
+ACoreHUD* UCoreWidgetComponent::GetOwningCoreHUD() const
+{
+	ULocalPlayer* LocalPlayer = GetOwnerPlayer();
+	APlayerController* PlayerController = LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+	return PlayerController ? PlayerController->GetHUD<ACoreHUD>() : nullptr;
 }
\ No newline at end of file
@@ -3,6 +3,11 @@
 
 #include "UI/StatusEffectUserWidget.h"
 #include "Gameplay/StatusEffect/StatusEffectBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Player/CoreHUD.h"
+#include "GameFramework/GameStateBase.h"
+#include "Components/Image.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 UStatusEffectUserWidget::UStatusEffectUserWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -14,16 +19,165 @@ void UStatusEffectUserWidget::NativePreConstruct()
 {
 	if (!bHasPerformedFirstPreConsturct)
 	{
-		if (StatusEffect)
-		{
-			StatusEffect->OnEffectEnd.AddDynamic(this, &UStatusEffectUserWidget::ReceiveStatusEffectEnd);
-		}
+		BindToStatusEffect();
 		bHasPerformedFirstPreConsturct = true;
 	}
 
 	Super::NativePreConstruct();
 }
 
+void UStatusEffectUserWidget::NativeOnReleasedToPool()
+{
+	SetStatusEffect(nullptr);
+
+	Super::NativeOnReleasedToPool();
+}
+
+void UStatusEffectUserWidget::SetStatusEffect(UStatusEffectBase* InStatusEffect)
+{
+	if (StatusEffect == InStatusEffect && bHasPerformedFirstPreConsturct)
+	{
+		return;
+	}
+
+	UnbindFromStatusEffect();
+
+	//Binding is now handled here so pre-construct should not bind again.
+	bHasPerformedFirstPreConsturct = true;
+
+	StatusEffect = InStatusEffect;
+	OnStatusEffectChanged(StatusEffect);
+	BindToStatusEffect();
+}
+
+void UStatusEffectUserWidget::BindToStatusEffect()
+{
+	if (!StatusEffect)
+	{
+		return;
+	}
+
+	StatusEffect->OnEffectEnd.AddUniqueDynamic(this, &UStatusEffectUserWidget::ReceiveStatusEffectEnd);
+
+	if (UStatusEffectBasic* StatusEffectBasic = Cast<UStatusEffectBasic>(StatusEffect))
+	{
+		StatusEffectBasic->OnStatusTimeUpdate.AddUniqueDynamic(this, &UStatusEffectUserWidget::ReceiveStatusTimeUpdate);
+		StatusEffectBasic->OnPowerUpdate.AddUniqueDynamic(this, &UStatusEffectUserWidget::ReceivePowerUpdate);
+		ReceivePowerUpdate(StatusEffectBasic, StatusEffectBasic->GetCurrentPower());
+	}
+	else if (UStatusEffectStack* StatusEffectStack = Cast<UStatusEffectStack>(StatusEffect))
+	{
+		StatusEffectStack->OnStatusTimeUpdate.AddUniqueDynamic(this, &UStatusEffectUserWidget::ReceiveStatusTimeUpdate);
+		StatusEffectStack->OnStackCountUpdate.AddUniqueDynamic(this, &UStatusEffectUserWidget::ReceiveStackCountUpdate);
+		ReceiveStackCountUpdate(StatusEffectStack, StatusEffectStack->GetStackCount());
+	}
+
+	float StartTime = -1.f;
+	float EndTime = -1.f;
+	StatusEffect->GetStatusTime(StartTime, EndTime);
+	ReceiveStatusTimeUpdate(StatusEffect, StartTime, EndTime);
+}
+
+void UStatusEffectUserWidget::UnbindFromStatusEffect()
+{
+	if (!StatusEffect)
+	{
+		return;
+	}
+
+	StatusEffect->OnEffectEnd.RemoveDynamic(this, &UStatusEffectUserWidget::ReceiveStatusEffectEnd);
+
+	if (UStatusEffectBasic* StatusEffectBasic = Cast<UStatusEffectBasic>(StatusEffect))
+	{
+		StatusEffectBasic->OnStatusTimeUpdate.RemoveDynamic(this, &UStatusEffectUserWidget::ReceiveStatusTimeUpdate);
+		StatusEffectBasic->OnPowerUpdate.RemoveDynamic(this, &UStatusEffectUserWidget::ReceivePowerUpdate);
+	}
+	else if (UStatusEffectStack* StatusEffectStack = Cast<UStatusEffectStack>(StatusEffect))
+	{
+		StatusEffectStack->OnStatusTimeUpdate.RemoveDynamic(this, &UStatusEffectUserWidget::ReceiveStatusTimeUpdate);
+		StatusEffectStack->OnStackCountUpdate.RemoveDynamic(this, &UStatusEffectUserWidget::ReceiveStackCountUpdate);
+	}
+}
+
+void UStatusEffectUserWidget::ReceiveStatusTimeUpdate(UStatusEffectBase* Status, float StartTime, float EndTime)
+{
+	UpdateStatusTimeMaterial(StartTime, EndTime);
+	OnStatusTimeChanged(StartTime, EndTime);
+}
+
+void UStatusEffectUserWidget::ReceivePowerUpdate(UStatusEffectBase* Status, float Power)
+{
+	OnPowerChanged(Power);
+}
+
+void UStatusEffectUserWidget::ReceiveStackCountUpdate(UStatusEffectBase* Status, uint8 StackCount)
+{
+	OnStackCountChanged(StackCount);
+}
+
+void UStatusEffectUserWidget::UpdateStatusTimeMaterial(float StartTime, float EndTime)
+{
+	if (!StatusTimeImage)
+	{
+		return;
+	}
+
+	if (!StatusTimeMaterial)
+	{
+		StatusTimeMaterial = StatusTimeImage->GetDynamicMaterial();
+
+		if (!StatusTimeMaterial)
+		{
+			return;
+		}
+	}
+
+	if (StartTime < 0.f || EndTime < 0.f)
+	{
+		StatusTimeMaterial->SetScalarParameterValue(StatusTimeStartParameter, -1.f);
+		StatusTimeMaterial->SetScalarParameterValue(StatusTimeEndParameter, -1.f);
+		return;
+	}
+
+	const AGameStateBase* GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+
+	if (!GameState)
+	{
+		return;
+	}
+
+	//Status time is in server world time while UI materials are driven by application time.
+	const float TimeOffset = float(FPlatformTime::Seconds() - GStartTime) - GameState->GetServerWorldTimeSeconds();
+	StatusTimeMaterial->SetScalarParameterValue(StatusTimeStartParameter, StartTime + TimeOffset);
+	StatusTimeMaterial->SetScalarParameterValue(StatusTimeEndParameter, EndTime + TimeOffset);
+}
+
+UStatusEffectUserWidget* UStatusEffectUserWidget::AcquireStatusEffectWidget(APlayerController* PlayerController, TSubclassOf<UStatusEffectUserWidget> WidgetClass, UStatusEffectBase* InStatusEffect)
+{
+	if (!PlayerController || !WidgetClass)
+	{
+		return nullptr;
+	}
+
+	UStatusEffectUserWidget* Widget = nullptr;
+
+	if (ACoreHUD* CoreHUD = PlayerController->GetHUD<ACoreHUD>())
+	{
+		Widget = Cast<UStatusEffectUserWidget>(CoreHUD->AcquireWidget(WidgetClass.Get()));
+	}
+	else
+	{
+		Widget = CreateWidget<UStatusEffectUserWidget>(PlayerController, WidgetClass);
+	}
+
+	if (Widget)
+	{
+		Widget->SetStatusEffect(InStatusEffect);
+	}
+
+	return Widget;
+}
+
 UBaseStatusEffectUserWidget::UBaseStatusEffectUserWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -13,6 +13,46 @@ class UCoreCharacterMovementComponent;
 class UWeapon;
 class UAnimSequence;
 class UAnimMontage;
+class UStatusEffectBase;
+
+//A status montage currently looping on a UCoreCharacterAnimInstance.
+USTRUCT()
+struct FStatusMontageLoop
+{
+	GENERATED_USTRUCT_BODY()
+
+	FStatusMontageLoop() {}
+
+	FStatusMontageLoop(UAnimMontage* InMontage, float InLoopEndWorldTime)
+		: Montage(InMontage), LoopEndWorldTime(InLoopEndWorldTime) {}
+
+public:
+	UPROPERTY()
+	UAnimMontage* Montage = nullptr;
+	//World time at which the montage should jump to its loop end section. -1 if the loop is ended elsewhere.
+	UPROPERTY()
+	float LoopEndWorldTime = -1.f;
+};
+
+//Hit reaction received on the game thread. Direction is resolved by FCoreCharacterAnimInstanceProxy during the animation update.
+struct FPendingHitReaction
+{
+	EHitReactionStrength Strength = EHitReactionStrength::Invalid;
+	FVector HitDirection = FVector::ZeroVector;
+	FRandomStream Random;
+	EHitReactionDirection Direction = EHitReactionDirection::Front;
+};
+
+//Status effect start received on the game thread. Direction is resolved by FCoreCharacterAnimInstanceProxy during the animation update.
+struct FPendingStatusMontage
+{
+	TWeakObjectPtr<UStatusEffectBase> StatusEffect = nullptr;
+	EStatusBeginType BeginType = EStatusBeginType::Invalid;
+	FVector InstigationDirection = FVector::ZeroVector;
+	EHitReactionDirection Direction = EHitReactionDirection::Front;
+};
+
+#define MAX_PENDING_HIT_REACTIONS 4
 
 USTRUCT(BlueprintType)
 struct FCoreCharacterAnimInstanceProxy : public FAnimInstanceProxy
@@ -50,9 +90,27 @@ public:
     UPROPERTY(Transient, BlueprintReadOnly, Category = CoreCharacterAnimInstanceProxy)
     bool bIsLowLOD = false;
 
+    UPROPERTY(Transient, BlueprintReadOnly, Category = CoreCharacterAnimInstanceProxy)
+    FLocomotionAnimationContainer LocomotionAnimations;
+
 
 protected:
 	virtual void PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds) override;
+	virtual void Update(float DeltaSeconds) override;
+	virtual void PostUpdate(UAnimInstance* InAnimInstance) const override;
+
+	static EHitReactionDirection GetHitReactionDirection(const FVector& Direction, const FVector& Forward, const FVector& Right);
+
+protected:
+	//Game thread state gathered in PreUpdate, resolved in Update and applied in PostUpdate.
+	FVector ActorForwardVector = FVector::ForwardVector;
+	FVector ActorRightVector = FVector::RightVector;
+	float WorldTimeSeconds = 0.f;
+
+	TArray<FPendingHitReaction, TInlineAllocator<MAX_PENDING_HIT_REACTIONS>> PendingHitReactionList;
+	TArray<FPendingStatusMontage, TInlineAllocator<2>> PendingStatusMontageList;
+	TArray<FStatusMontageLoop, TInlineAllocator<2>> StatusMontageLoopList;
+	TArray<UAnimMontage*, TInlineAllocator<2>> LoopEndMontageList;
 };
 
 /**
@@ -63,6 +121,8 @@ class UCoreCharacterAnimInstance : public UAnimInstance
 {
 	GENERATED_UCLASS_BODY()
 
+	friend FCoreCharacterAnimInstanceProxy;
+
 public:	
 	UFUNCTION(BlueprintCallable, Category = Animation)
 	ACoreCharacter* GetCharacter() const;
@@ -75,7 +135,6 @@ public:
 
 	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override;
 	virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy) override;
-	virtual void BeginDestroy() override;
 
 	UFUNCTION()
 	const UAnimationObject* GetDefaultAnimationObject() const { return DefaultAnimationObject.GetDefaultObject(); }
@@ -84,11 +143,15 @@ public:
 	const UAnimationObject* GetCharacterAnimationObject() const;
 
 	UFUNCTION()
-	bool DoesMontageHaveRegisteredLoopTimerHandle(UAnimMontage* Montage) const;
+	bool DoesMontageHaveRegisteredLoop(UAnimMontage* Montage) const;
 	UFUNCTION()
-	void RegisterMontageLoopTimerHandle(UAnimMontage* Montage, FTimerHandle Handle);
+	void RegisterMontageLoop(UAnimMontage* Montage, float LoopEndWorldTime);
+	UFUNCTION()
+	void RevokeMontageLoop(UAnimMontage* Montage);
+
+	//Jumps a looping status montage to its loop end section and revokes its loop.
 	UFUNCTION()
-	void RevokeMontageLoopTimerHandle(UAnimMontage* Montage);
+	void PlayStatusMontageLoopEnd(UAnimMontage* Montage);
 
 public:
 	UPROPERTY(EditDefaultsOnly, Category = Animation)
@@ -127,12 +190,16 @@ protected:
 	UPROPERTY()
 	FLocomotionAnimationContainer WeaponLocomationAnimations;
 
-	//Used by anim BP. Set by FCoreCharacterAnimInstanceProxy::PreUpdate() to comply with async work.
+	//Set when the locomotion set changes. Anim graphs should prefer CoreCharacterProxy.LocomotionAnimations, which is gathered alongside the rest of the per-frame state.
 	UPROPERTY(Transient, BlueprintReadOnly, Category = Animation)
 	FLocomotionAnimationContainer LocomationAnimations;
 
+	//Status montages currently looping. Loop ends are checked by FCoreCharacterAnimInstanceProxy as part of the animation update.
 	UPROPERTY(Transient)
-	TMap<UAnimMontage*, FTimerHandle> StatusMontageLoopTimerMap = TMap<UAnimMontage*, FTimerHandle>();
+	TArray<FStatusMontageLoop> StatusMontageLoopList = TArray<FStatusMontageLoop>();
+
+	TArray<FPendingHitReaction, TInlineAllocator<MAX_PENDING_HIT_REACTIONS>> PendingHitReactionList;
+	TArray<FPendingStatusMontage, TInlineAllocator<2>> PendingStatusMontageList;
 
 protected:
 	UPROPERTY(Transient, BlueprintReadOnly, Category = Animation, meta = (AllowPrivateAccess = "true"))
@@ -141,5 +208,9 @@ protected:
 	UPROPERTY(Transient)
 	const UCoreCharacterMovementComponent* CoreCharacterMovementComponent;
 
+	//Cached in NativeInitializeAnimation so that the proxy does not need to cast the owning actor every update.
+	UPROPERTY(Transient)
+	ACoreCharacter* OwningCoreCharacter = nullptr;
+
 	FDelegateHandle HitEventDelegate = FDelegateHandle();
 };
\ No newline at end of file
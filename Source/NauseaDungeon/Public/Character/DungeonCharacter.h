@@ -11,6 +11,30 @@ class UCurveFloat;
 
 class UDungeonCharacterDescription;
 
+USTRUCT(BlueprintType)
+struct FDungeonCharacterNetLOD
+{
+	GENERATED_USTRUCT_BODY()
+
+	FDungeonCharacterNetLOD() {}
+
+	FDungeonCharacterNetLOD(float InSignificanceThreshold, float InNetUpdateFrequencyScale, bool bInDeferNonCriticalReplication)
+		: SignificanceThreshold(InSignificanceThreshold), NetUpdateFrequencyScale(InNetUpdateFrequencyScale), bDeferNonCriticalReplication(bInDeferNonCriticalReplication) {}
+
+public:
+	//Minimum significance (as calculated for animation budgeting) the most significant connection's view of this character must have to use this LOD.
+	UPROPERTY(EditDefaultsOnly, Category = NetLOD)
+	float SignificanceThreshold = 0.f;
+
+	//Scale applied to the class default NetUpdateFrequency.
+	UPROPERTY(EditDefaultsOnly, Category = NetLOD)
+	float NetUpdateFrequencyScale = 1.f;
+
+	//If true, cosmetic status component data (hit events, part health) is deferred. See UStatusComponent::SetDeferNonCriticalReplication.
+	UPROPERTY(EditDefaultsOnly, Category = NetLOD)
+	bool bDeferNonCriticalReplication = false;
+};
+
 UCLASS(Blueprintable)
 class ADungeonCharacter : public ACoreCharacter
 {
@@ -19,6 +43,7 @@ class ADungeonCharacter : public ACoreCharacter
 //~ Begin AActor Interface
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 public:
 	virtual void PreRegisterAllComponents() override;
 //~ End AActor Interface
@@ -34,6 +59,17 @@ public:
 
 	void NotifyCharacterUnableToPath();
 
+	//Significance of a character's bounds when seen from a given view location. Shared by animation budgeting and net LOD.
+	static float CalculateSignificance(const AActor* Owner, const FBoxSphereBounds& LocalBounds, const FVector& ViewLocation);
+
+	int32 GetNetLOD() const { return CurrentNetLOD; }
+
+protected:
+	//Evaluated on the server. Picks a net LOD based on the most significant view any player has of this character.
+	UFUNCTION()
+	void UpdateNetLOD();
+	void ApplyNetLOD(int32 NetLOD);
+
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = Mesh)
 	UPhysicsAsset* RagdollPhysicsAsset = nullptr;
@@ -57,6 +93,19 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = Dungeon)
 	TSubclassOf<UDungeonCharacterDescription> CharacterDescription = nullptr;
 
+	//Ordered from most to least significant. The first entry whose threshold is met is used.
+	UPROPERTY(EditDefaultsOnly, Category = Replication)
+	TArray<FDungeonCharacterNetLOD> NetLODList;
+
+	UPROPERTY(EditDefaultsOnly, Category = Replication)
+	float NetLODUpdateInterval = 0.5f;
+
+	UPROPERTY(Transient)
+	int32 CurrentNetLOD = INDEX_NONE;
+
+	UPROPERTY(Transient)
+	FTimerHandle NetLODTimerHandle;
+
 public:
 	UFUNCTION(BlueprintCallable, Category = Dungeon)
 	static TSubclassOf<UDungeonCharacterDescription> GetCharacterDescriptor(TSubclassOf<ADungeonCharacter> DungeonCharacterClass);
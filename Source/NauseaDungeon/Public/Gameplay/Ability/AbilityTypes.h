@@ -11,6 +11,8 @@
 class UAbilityInfo;
 class UAbilityComponent;
 
+DECLARE_STATS_GROUP(TEXT("AbilityComponent"), STATGROUP_AbilityComponent, STATCAT_Advanced);
+
 //Contains data about a given ability. Cast and recharge timings as well as charge count is stored here.
 USTRUCT(BlueprintType)
 struct FAbilityData
@@ -88,6 +90,7 @@ public:
 
 	FORCEINLINE bool operator== (FAbilityTargetDataHandle InData) const { return Handle == InData.Handle; }
 	FORCEINLINE bool operator== (uint64 InID) const { return this->Handle == InID; }
+	FORCEINLINE bool operator< (FAbilityTargetDataHandle InData) const { return Handle < InData.Handle; }
 	friend FArchive& operator<<(FArchive& Ar, FAbilityTargetDataHandle& AbilityTargetDataHandle) { Ar << AbilityTargetDataHandle.Handle; return Ar; }
 
 	bool IsValid() const { return Handle != MAX_uint64; }
@@ -126,6 +129,19 @@ enum class ETargetDataType : uint8
 	Invalid
 };
 
+//How target data transforms are quantized when replicated. Chosen per UAbilityInfo.
+UENUM(BlueprintType)
+enum class ETargetDataQuantization : uint8
+{
+	//Full precision transforms.
+	None,
+	//Locations rounded to 0.1 units, rotations compressed to 16 bits per axis.
+	Medium,
+	//Locations rounded to whole units, rotations compressed to 8 bits per axis.
+	Low,
+	MAX UMETA(Hidden)
+};
+
 USTRUCT(BlueprintType)
 struct FAbilityTargetData
 {
@@ -218,6 +234,9 @@ protected:
 
 public:
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	//Serializes this target data using the given quantization. If provided, transforms are delta encoded against PreviousTargetData (must already be serialized).
+	bool NetSerializeQuantized(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess, ETargetDataQuantization Quantization, const FAbilityTargetData* PreviousTargetData);
 };
 
 template<>
@@ -239,18 +258,43 @@ struct FAbilityTargetDataContainer
 	FAbilityTargetDataContainer(const TArray<FAbilityTargetData>& InTargetDataList)
 	{
 		TargetDataList = InTargetDataList;
+		SortTargetDataList();
 	}
 
 	FORCEINLINE TArray<FAbilityTargetData>& GetTargetDataList() { return TargetDataList; }
 	FORCEINLINE const TArray<FAbilityTargetData>& GetTargetDataList() const { return TargetDataList; }
 
+	//Target data list is kept sorted by handle so that UpdateTargetDataCache can diff against the cache with a single linear merge.
+	void SortTargetDataList();
 	void UpdateTargetDataCache(TArray<FAbilityTargetData>& AddedTargetData, TArray<FAbilityTargetData>& RemovedTargetData) const;
 
+	FORCEINLINE ETargetDataQuantization GetQuantization() const { return Quantization; }
+	void SetQuantization(ETargetDataQuantization InQuantization) { Quantization = InQuantization; }
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	//Upper bound on target data accepted from the network.
+	static constexpr int32 MaxReplicatedTargetDataCount = 256;
+
 protected:
 	UPROPERTY()
 	TArray<FAbilityTargetData> TargetDataList;
+	//Sorted by handle.
 	UPROPERTY(NotReplicated)
-	TMap<FAbilityTargetDataHandle, FAbilityTargetData> TargetDataListCache;
+	TArray<FAbilityTargetData> TargetDataListCache;
+
+	//Written as part of this container's NetSerialize so that clients know how to read the target data list.
+	UPROPERTY()
+	ETargetDataQuantization Quantization = ETargetDataQuantization::None;
+};
+
+template<>
+struct TStructOpsTypeTraits< FAbilityTargetDataContainer > : public TStructOpsTypeTraitsBase2< FAbilityTargetDataContainer >
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
 };
 
 USTRUCT()
@@ -315,6 +315,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Ability)
 	int32 GetMaxTargetCount() const { return MaxTargetCount; }
 
+	UFUNCTION(BlueprintCallable, Category = Ability)
+	ETargetDataQuantization GetTargetDataQuantization() const { return TargetDataQuantization; }
+
 	UFUNCTION(BlueprintCallable, Category = Ability)
 	bool NeedsLineOfSight() const { return bNeedLineOfSightToTarget; }
 	UFUNCTION(BlueprintCallable, Category = Ability)
@@ -397,6 +400,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = Ability)
 	int32 MaxTargetCount = 1;
 
+	//How precisely this ability's target data transforms are replicated.
+	UPROPERTY(EditDefaultsOnly, Category = Ability)
+	ETargetDataQuantization TargetDataQuantization = ETargetDataQuantization::Medium;
+
 	UPROPERTY(EditDefaultsOnly, Category = Ability)
 	TSoftClassPtr<UAbilityDecalComponent> AbilityDecalClass = nullptr;
 
@@ -47,6 +47,9 @@ public:
 	static FText GetDamageLogEventText(FDamageLogEvent DamageLogEvent);
 	UFUNCTION(BlueprintCallable, Category = DamageLogInterface)
 	static FText GetDamageLogModificationText(FDamageLogEventModifier DamageLogEventModifier);
+	//Generates text for every modifier applied to the given damage log event. Modifiers that produce no text are skipped.
+	UFUNCTION(BlueprintCallable, Category = DamageLogInterface)
+	static TArray<FText> GetDamageLogModificationTextList(FDamageLogEvent DamageLogEvent);
 
 
 	static FText GenerateDamageLogEventText(const FDamageLogEvent& DamageLogEvent);
@@ -17,12 +17,15 @@ class UDamageLogModifierObject : public UObject, public IDamageLogInterface
 
 //~ Begin IDamageLogInterface Interface
 public:
-	virtual FText GetDamageLogInstigatorName() const override { return InstigatorName; }
+	virtual FText GetDamageLogInstigatorName() const override;
 //~ End IDamageLogInterface Interface
 
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = DamageLogModifier)
 	FText InstigatorName = FText::GetEmpty();
+
+	//Key into the damage log string table used when InstigatorName is empty. Native modifiers use this so their text is only resolved once a damage log is displayed.
+	FString InstigatorNameTableKey;
 };
 
 UCLASS()
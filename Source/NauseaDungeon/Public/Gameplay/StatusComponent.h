@@ -259,6 +259,45 @@ public:
 	FVector_NetQuantize HitMomentum;
 };
 
+//Status effect a damage type applies to a status component. Power already includes the component's generic status effect multiplier.
+USTRUCT()
+struct FDamageTypeStatusEffectEntry
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY()
+	TSubclassOf<UStatusEffectBase> StatusEffectClass = nullptr;
+	UPROPERTY()
+	float Power = 0.f;
+};
+
+USTRUCT()
+struct FDamageTypeStatusEffectList
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FDamageTypeStatusEffectEntry> EntryList;
+};
+
+//Damage received from a single instigator and damage type within a frame. Used when UStatusComponent::bAggregateDamageEvents is set.
+struct FAggregatedDamageEvent
+{
+	TWeakObjectPtr<AController> EventInstigator = nullptr;
+	TWeakObjectPtr<AActor> DamageCauser = nullptr;
+	TSubclassOf<UDamageType> DamageTypeClass = nullptr;
+
+	float Damage = 0.f;
+	float Threat = 0.f;
+	int32 HitCount = 0;
+
+	FVector InstigationLocation = FVector::ZeroVector;
+	FVector HitLocation = FVector::ZeroVector;
+	FVector DamageDirection = FVector::ZeroVector;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FHealthChangedSignature, UStatusComponent*, Component, float, Health, float, PreviousHealth);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FMaxHealthChangedSignature, UStatusComponent*, Component, float, MaxHealth, float, PreviousMaxHealth);
 
@@ -285,12 +324,17 @@ class UStatusComponent : public UActorComponent, public IGenericTeamAgentInterfa
 	//Callbacks need to be used but are protected (and should obviously not be public).
 	friend FHitEventContainer;
 
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FStatusComponentTakeDamagePerformanceTest;
+#endif //WITH_DEV_AUTOMATION_TESTS
+
 //~ Begin UActorComponent Interface 
 protected:
 	virtual void InitializeComponent() override;
 	virtual void BeginPlay() override;
 public:
 	virtual bool ReplicateSubobjects(class UActorChannel* Channel, class FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 //~ End UActorComponent Interface
 
 //~ Begin IGenericTeamAgentInterface Interface
@@ -380,6 +424,13 @@ public:
 	UFUNCTION()
 	void OnStatusEffectRemoved(UStatusEffectBase* StatusEffect);
 
+	//Resets and stores a removed status effect for reuse. Returns false if the status effect should be destroyed instead.
+	bool ReturnStatusEffectToPool(UStatusEffectBase* StatusEffect);
+
+	//Used by net LOD. While set, hit events stop replicating and part health only replicates every DeferredReplicationInterval seconds.
+	void SetDeferNonCriticalReplication(bool bInDeferNonCriticalReplication);
+	bool IsDeferringNonCriticalReplication() const { return bDeferNonCriticalReplication; }
+
 public:
 	UPROPERTY(BlueprintAssignable, Category = StatusComponent)
 	FHealthChangedSignature OnHealthChanged;
@@ -472,9 +523,16 @@ protected:
 
 	virtual void HandleDamageTypeStatus(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser);
 
+	//Returns the status effects the given damage type applies to this component, building and caching the list the first time the damage type is received.
+	const TArray<FDamageTypeStatusEffectEntry>& GetDamageTypeStatusEffectList(const class UCoreDamageType* CoreDamageType);
+	//Clears cached damage type status effect lists. Must be called whenever generic status effect configuration changes.
+	void ResetDamageTypeStatusEffectTable() { DamageTypeStatusEffectTable.Reset(); }
+
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = StatusComponent)
 	virtual UStatusEffectBase* AddStatusEffect(TSubclassOf<UStatusEffectBase> StatusEffectClass, struct FDamageEvent const& DamageEvent, AController* EventInstigator, float Power = -1.f);
 
+	UStatusEffectBase* TakePooledStatusEffect(TSubclassOf<UStatusEffectBase> StatusEffectClass);
+
 	UFUNCTION()
 	virtual void UpdateDeathEvent(float DamageAmount, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser);
 
@@ -484,6 +542,12 @@ protected:
 	void GenerateHitEvent(FHitEvent&& InHitEvent);
 	UFUNCTION()
 	void CleanupHitEvent(uint64 ID);
+
+	//Merges a hit into this frame's aggregated damage event for its instigator and damage type.
+	void AggregateDamageEvent(float DamageAmount, float Threat, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser, const FVector& InstigationLocation, const FVector& HitLocation, const FVector& DamageDirection);
+	//Sends a single perception report, hit event and OnDamageReceived broadcast per aggregated damage event.
+	UFUNCTION()
+	void FlushAggregatedDamageEvents();
 	UFUNCTION()
 	void PlayHitEffect(const FHitEvent& HitEvent);
 
@@ -491,6 +555,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = StatusComponent)
 	bool ShouldPerformDamageLog() const { return bPerformDamageLog; }
 
+	//Copies the most recent damage log events (newest first) into OutDamageLogList. Text for these can be generated through UDamageLogStatics when needed.
+	UFUNCTION(BlueprintCallable, Category = StatusComponent)
+	void GetRecentDamageLogs(TArray<FDamageLogEvent>& OutDamageLogList) const;
+
+	const FDamageLogHistory& GetDamageLogHistory() const { return DamageLogHistory; }
+
 	inline void MarkDeathEvent();
 	inline void PushDamageLogModifier(FDamageLogEventModifier&& Modifier);
 
@@ -543,6 +613,16 @@ protected:
 
 	UPROPERTY(Transient)
 	TArray<UStatusEffectBase*> StatusEffectList;
+	//Index of StatusEffectList by status effect class.
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UStatusEffectBase>, UStatusEffectBase*> StatusEffectClassMap;
+
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UDamageType>, FDamageTypeStatusEffectList> DamageTypeStatusEffectTable;
+
+	//Only one status effect of a given class can be active at a time so a single pooled instance per class is enough.
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UStatusEffectBase>, UStatusEffectBase*> PooledStatusEffectMap;
 
 	UPROPERTY(Transient)
 	TMap<EStatusType, TSubclassOf<UStatusEffectBase>> GenericStatusEffectMap;
@@ -605,6 +685,26 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = StatusComponent)
 	bool bReplicateHitEvents = false;
 
+	//If true, hit events, perception reports and OnDamageReceived broadcasts are merged per instigator and damage type and sent once per frame. Health is still applied per hit.
+	UPROPERTY(EditDefaultsOnly, Category = StatusComponent)
+	bool bAggregateDamageEvents = false;
+
+	//If true, status effects that end are reset and reused the next time a status effect of the same class is applied instead of being destroyed.
+	UPROPERTY(EditDefaultsOnly, Category = StatusComponent)
+	bool bPoolStatusEffects = true;
+
+	UPROPERTY(EditDefaultsOnly, Category = StatusComponent)
+	float DeferredReplicationInterval = 1.f;
+
+	UPROPERTY(Transient)
+	bool bDeferNonCriticalReplication = false;
+	UPROPERTY(Transient)
+	bool bReplicatingHitEvents = true;
+	UPROPERTY(Transient)
+	bool bReplicatingPartHealth = true;
+	UPROPERTY(Transient)
+	float NextDeferredReplicationTime = 0.f;
+
 	UPROPERTY(ReplicatedUsing = OnRep_TeamId)
 	FGenericTeamId TeamId = FGenericTeamId::NoTeam;
 
@@ -617,6 +717,10 @@ protected:
 
 	UPROPERTY(Transient)
 	FDamageLogStack DamageLogStack;
+	UPROPERTY(Transient)
+	FDamageLogHistory DamageLogHistory;
+
+	TArray<FAggregatedDamageEvent, TInlineAllocator<4>> AggregatedDamageEventList;
 
 	UPROPERTY(Transient)
 	bool bAutomaticallyInitialize = true;
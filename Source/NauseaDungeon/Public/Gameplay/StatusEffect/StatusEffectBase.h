@@ -62,7 +62,6 @@ class UStatusEffectBase : public UObject, public IDamageLogInterface, public IRe
 //~ Begin UObject Interface
 public:
 	virtual void PostInitProperties() override;
-	virtual void PreNetReceive() override;
 	virtual void PostNetReceive() override;
 	virtual void PreDestroyFromReplication() override;
 	virtual void BeginDestroy() override;
@@ -84,6 +83,13 @@ public:
 
 	virtual void OnDestroyed();
 
+	//Returns this status effect to its class defaults so its owning status component can pool and reuse it. On clients, replicated properties are left to the server.
+	virtual void ResetForReuse();
+	bool IsPooled() const { return bPooled; }
+	void SetPooled(bool bInPooled);
+	//Used by clients to detect that the server has pooled this status effect since the last update.
+	bool IsPendingPoolReturn() const { return LastReceivedPoolGeneration != PoolGeneration; }
+
 	virtual bool CanActivateStatus(ACorePlayerState* Instigator, float Power) const;
 	virtual bool CanRefreshStatus(ACorePlayerState* Instigator, float Power) const;
 
@@ -231,6 +237,12 @@ protected:
 	UPROPERTY(EditDefaultsOnly)
 	EInstigationDirectionUpdateRule InstigationUpdateDirectionRule = EInstigationDirectionUpdateRule::Never;
 
+	UPROPERTY(Replicated)
+	bool bPooled = false;
+	//Incremented every time this status effect is returned to its pool.
+	UPROPERTY(Replicated)
+	uint8 PoolGeneration = 0;
+
 
 private:
 	UWorld* GetWorld_Uncached() const;
@@ -243,6 +255,9 @@ private:
 
 	UPROPERTY(Transient)
 	bool bDoneRemotePostNetReceiveActivation = false;
+
+	//Not a property so that it survives ResetForReuse.
+	uint8 LastReceivedPoolGeneration = 0;
 };
 
 UENUM(BlueprintType)
@@ -282,6 +297,7 @@ public:
 public:
 	virtual void Initialize(UStatusComponent* StatusComponent, ACorePlayerState* Instigator, float Power, const FVector& InstigationDirection) override;
 	virtual void OnDestroyed() override;
+	virtual void ResetForReuse() override;
 	virtual void OnActivated(EStatusBeginType BeginType) override;
 	virtual void OnDeactivated(EStatusEndType EndType) override;
 	virtual bool CanActivateStatus(ACorePlayerState* Instigator, float Power) const override;
@@ -451,6 +467,7 @@ public:
 	virtual bool CanActivateStatus(ACorePlayerState* Instigator, float Power) const override;
 	virtual bool CanRefreshStatus(ACorePlayerState* Instigator, float Power) const override;
 	virtual void AddEffectPower(ACorePlayerState* Instigator, float Power, const FVector& InstigationDirection) override;
+	virtual void GetStatusTime(float& StartTime, float& EndTime) const override;
 //~ End UStatusEffectBase Interface
 
 public:
@@ -94,6 +94,11 @@ struct FDamageLogEventModifier
 class AController;
 class UCoreDamageType;
 
+//Number of modifiers a damage log event stores inline. Pushing up to this many never allocates, any beyond it spill to the heap.
+#define DAMAGE_LOG_INLINE_MODIFIERS 8
+//Number of finalized damage log events a status component keeps around for UI/debug consumers.
+#define DAMAGE_LOG_HISTORY_SIZE 16
+
 USTRUCT(BlueprintType)
 struct FDamageLogEvent
 {
@@ -110,11 +115,14 @@ struct FDamageLogEvent
 		InstigatorDamageType = InInstigatorDamageType;
 
 		InstigatorTeam = InInstigatorTeam;
-		ModifierList = TArray<FDamageLogEventModifier>();
 	}
 
 public:
-	bool PushModifier(FDamageLogEventModifier&& Modifier) { ModifierList.Add(MoveTemp(Modifier)); return true; }
+	bool PushModifier(FDamageLogEventModifier&& Modifier)
+	{
+		ModifierList.Add(MoveTemp(Modifier));
+		return true;
+	}
 
 	void FinalizeDamageLog(float InDamageDealt) { DamageDealt = InDamageDealt; }
 
@@ -135,6 +143,8 @@ public:
 	FORCEINLINE void MarkDeathEvent() { bDeathEvent = true; }
 	FORCEINLINE bool IsDeathEvent() const { return bDeathEvent; }
 
+	FORCEINLINE const TArray<FDamageLogEventModifier, TInlineAllocator<DAMAGE_LOG_INLINE_MODIFIERS>>& GetModifierList() const { return ModifierList; }
+
 public:
 	UPROPERTY()
 	float DamageInitial = -1.f;
@@ -151,8 +161,8 @@ public:
 	UPROPERTY()
 	FGenericTeamId InstigatorTeam = FGenericTeamId::NoTeam;
 
-	UPROPERTY()
-	TArray<FDamageLogEventModifier> ModifierList = TArray<FDamageLogEventModifier>();
+	//Not a UPROPERTY so that it can be stored inline. Modifiers only hold weak references so they do not need to be visible to GC.
+	TArray<FDamageLogEventModifier, TInlineAllocator<DAMAGE_LOG_INLINE_MODIFIERS>> ModifierList;
 
 	UPROPERTY()
 	bool bDeathEvent = false;
@@ -172,8 +182,41 @@ public:
 	inline FDamageLogEvent Pop() { return Stack.Pop(false); }
 
 protected:
-	UPROPERTY()
-	TArray<FDamageLogEvent> Stack = TArray<FDamageLogEvent>();
+	//Damage events only nest when damage is applied from within damage handling (reflection, friendly fire, etc.) so a small inline stack is enough to never allocate.
+	TArray<FDamageLogEvent, TInlineAllocator<4>> Stack;
+};
+
+//Fixed capacity ring buffer of finalized damage log events. Recording is a copy into a preallocated slot, text is only generated when a consumer asks for it (see UDamageLogStatics).
+USTRUCT(BlueprintType)
+struct FDamageLogHistory
+{
+	GENERATED_USTRUCT_BODY()
+
+	FDamageLogHistory() {}
+
+public:
+	inline void Record(const FDamageLogEvent& Entry)
+	{
+		EntryList[HeadIndex] = Entry;
+		HeadIndex = (HeadIndex + 1) % DAMAGE_LOG_HISTORY_SIZE;
+		EntryCount = FMath::Min(EntryCount + 1, DAMAGE_LOG_HISTORY_SIZE);
+	}
+
+	FORCEINLINE int32 Num() const { return EntryCount; }
+
+	//Index 0 is the most recently recorded event.
+	FORCEINLINE const FDamageLogEvent& Get(int32 Index) const
+	{
+		check(Index >= 0 && Index < EntryCount);
+		return EntryList[(HeadIndex - 1 - Index + DAMAGE_LOG_HISTORY_SIZE) % DAMAGE_LOG_HISTORY_SIZE];
+	}
+
+	inline void Reset() { HeadIndex = 0; EntryCount = 0; }
+
+protected:
+	FDamageLogEvent EntryList[DAMAGE_LOG_HISTORY_SIZE];
+	int32 HeadIndex = 0;
+	int32 EntryCount = 0;
 };
 
 UENUM(BlueprintType)
@@ -226,6 +269,9 @@ public:
 	FRandomStream Random;
 	UPROPERTY()
 	uint64 ID = 0;
+	//Number of hits this event represents. Greater than 1 when damage events are aggregated.
+	UPROPERTY()
+	uint8 HitCount = 1;
 
 	static uint64 IDCounter;
 };
\ No newline at end of file
@@ -66,6 +66,52 @@ protected:
 	UWaveConfiguration* Configuration = nullptr;
 };
 
+//Precomputed spawn parameters of a single wave configuration for a given wave.
+USTRUCT(BlueprintType)
+struct FWaveConfigurationSchedule
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	FWaveConfigurationSchedule() {}
+	FWaveConfigurationSchedule(int32 InConfigurationIndex, int32 InSpawnCount, int32 InTimeOffset, int32 InTimeInterval, int32 InSpawnBatchAmount)
+		: ConfigurationIndex(InConfigurationIndex), SpawnCount(InSpawnCount), TimeOffset(InTimeOffset), TimeInterval(InTimeInterval), SpawnBatchAmount(InSpawnBatchAmount) {}
+
+public:
+	//Index of the configuration in the owning setup. 0 is the default wave configuration, N is the configuration of ModifierList[N - 1].
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	int32 ConfigurationIndex = INDEX_NONE;
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	int32 SpawnCount = 0;
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	int32 TimeOffset = 0;
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	int32 TimeInterval = 0;
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	int32 SpawnBatchAmount = 0;
+};
+
+//Flattened result of resolving modifiers and evaluating scaling curves for a single wave.
+USTRUCT(BlueprintType)
+struct FWaveSchedule
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	FWaveSchedule() {}
+
+	bool IsValid() const { return WaveNumber != INDEX_NONE; }
+
+public:
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	int64 WaveNumber = INDEX_NONE;
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	int64 TotalSpawnCount = 0;
+	UPROPERTY(VisibleAnywhere, Category = Schedule)
+	TArray<FWaveConfigurationSchedule> ConfigurationScheduleList;
+
+	static FWaveSchedule InvalidSchedule;
+};
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWaveCompletedSignature, UDungeonWaveSetup*, WaveSetup, int64, WaveNumber);
 
@@ -77,6 +123,16 @@ class NAUSEADUNGEON_API UDungeonWaveSetup : public UObject
 {
 	GENERATED_UCLASS_BODY()
 
+//~ Begin UObject Interface
+public:
+#if WITH_EDITOR
+	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif //WITH_EDITOR
+//~ End UObject Interface
+
 public:
 	UFUNCTION(BlueprintCallable, Category = WaveSetup)
 	TArray<UWaveConfiguration*> GetWaveConfiguration(int64 WaveNumber) const;
@@ -108,6 +164,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = WaveSetup)
 	int64 GetExpectedSpawnCount() const { return TotalExpectedSpawnCount; }
 
+	//Flattens every wave up to LastWaveNumber into a precomputed schedule table. Performed when this setup is saved/cooked, waves missing from the table are built on demand at runtime.
+	UFUNCTION(BlueprintCallable, Category = WaveSetup)
+	void BakeWaveSchedule();
+	//Discards any baked or runtime built schedule. Needs to be called whenever configurations or modifiers are changed at runtime.
+	UFUNCTION(BlueprintCallable, Category = WaveSetup)
+	void InvalidateWaveSchedule();
+
+	//Returns the schedule for the given wave, building and caching it if it was not baked.
+	const FWaveSchedule& GetWaveSchedule(int32 WaveNumber);
+
+	//Returns a human readable timeline of the baked wave schedule, one configuration per line. Useful to diff balance changes.
+	UFUNCTION(BlueprintCallable, Category = WaveSetup)
+	FString DescribeWaveSchedule() const;
+
 	UFUNCTION(BlueprintCallable, Category = WaveSetup, meta = (WorldContext = "WorldContextObject", CallableWithoutWorldContext, AdvancedDisplay = 3))
 	static UDungeonWaveSetup* CreateWaveSetup(UObject* WorldContextObject, TSubclassOf<UDungeonWaveSetup> SetupClass, const TArray<FWaveModifierEntry>& AdditionalModifiers, bool bClearSetupClassModifiers = false,
 		UWaveConfiguration* DefaultWaveConfigurationOverride = nullptr, UCurveFloat* DefaultWaveSizeScalingOverride = nullptr, UCurveFloat* DefaultWaveRateScalingOverride = nullptr, int64 LastWaveNumberOverride = -1);
@@ -120,6 +190,18 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = WaveSetup)
 	FOnWaveCompletedSignature OnWaveCompleted;
 
+protected:
+	void GetWaveConfigurationIndexList(int64 WaveNumber, TArray<int32>& ConfigurationIndexList) const;
+	UWaveConfiguration* GetConfigurationByIndex(int32 ConfigurationIndex) const;
+
+	FWaveSchedule BuildWaveSchedule(int64 WaveNumber) const;
+
+#if WITH_EDITOR
+	//Baked schedules depend on curves and instanced configurations that can be edited without touching this setup.
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+	FDelegateHandle OnObjectPropertyChangedHandle;
+#endif //WITH_EDITOR
+
 protected:
 	//Last wave. If 0, we assume this endless.
 	UPROPERTY(EditAnywhere, Category = WaveSetup, meta = (ClampMin = "0"))
@@ -140,6 +222,13 @@ protected:
 	int64 InitializedWave = -1;
 	UPROPERTY(Transient)
 	int64 TotalExpectedSpawnCount = -1;
+
+	//Baked schedule table, indexed by wave number.
+	UPROPERTY(VisibleAnywhere, Category = WaveSetup, AdvancedDisplay)
+	TArray<FWaveSchedule> BakedWaveScheduleList;
+	//Schedules built at runtime for waves that were not baked (endless waves, setups created at runtime, etc.).
+	UPROPERTY(Transient)
+	TMap<int32, FWaveSchedule> RuntimeWaveScheduleMap;
 };
 
 UCLASS(BlueprintType, Blueprintable, EditInlineNew, DefaultToInstanced, AutoExpandCategories = (Configuration))
@@ -151,6 +240,10 @@ public:
 	//Initializes this configuration for the given wave number. Returns the total number of spawns.
 	UFUNCTION()
 	int32 InitializeForWave(int64 WaveNumber, UDungeonWaveSetup* Setup = nullptr);
+	//Initializes this configuration using precomputed values. Returns the total number of spawns.
+	int32 InitializeFromSchedule(int64 WaveNumber, const FWaveConfigurationSchedule& Schedule);
+	//Evaluates all scaling curves for the given wave.
+	FWaveConfigurationSchedule MakeSchedule(int64 WaveNumber, UDungeonWaveSetup* Setup = nullptr, int32 ConfigurationIndex = INDEX_NONE) const;
 	UFUNCTION()
 	void CleanUp();
 	UFUNCTION()
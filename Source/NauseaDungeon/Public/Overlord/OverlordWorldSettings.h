@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "System/CoreWorldSettings.h"
+#include "Overlord/PlacementTypes.h"
 #include "OverlordWorldSettings.generated.h"
 
+class UTrapActivationScheduler;
+
 /**
  * 
  */
@@ -17,4 +20,23 @@ class NAUSEADUNGEON_API AOverlordWorldSettings : public ACoreWorldSettings
 public:
 	UFUNCTION(CallInEditor, Category = "GridGeneration")
 	void BuildAllGridData();
+
+	FPlacementSpatialIndex& GetPlacementSpatialIndex() { return PlacementSpatialIndex; }
+	const FPlacementSpatialIndex& GetPlacementSpatialIndex() const { return PlacementSpatialIndex; }
+
+	static FPlacementSpatialIndex* FindPlacementSpatialIndex(const UObject* WorldContextObject);
+
+	//Lazily creates the scheduler that drives natively activated traps in this world.
+	UTrapActivationScheduler* GetTrapActivationScheduler();
+
+	//Returns true if a trap occupies the placement point at the given location.
+	UFUNCTION(BlueprintCallable, Category = Placement, meta = (WorldContext = "WorldContextObject"))
+	static bool IsPlacementLocationOccupied(const UObject* WorldContextObject, const FVector& WorldLocation);
+
+protected:
+	//Parentmost placement actors register themselves here on BeginPlay.
+	FPlacementSpatialIndex PlacementSpatialIndex = FPlacementSpatialIndex();
+
+	UPROPERTY(Transient)
+	UTrapActivationScheduler* TrapActivationScheduler = nullptr;
 };
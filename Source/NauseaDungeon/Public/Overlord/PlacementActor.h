@@ -46,6 +46,8 @@ class NAUSEADUNGEON_API APlacementActor : public AActor
 public:
 	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif //WITH_EDITOR
@@ -66,6 +68,14 @@ public:
 
 	void PushPlacementData(const FPlacementGrid& GridData);
 
+	//Occupancy changes are forwarded to the parentmost placement actor, which replicates them to clients.
+	bool SetPlacementOccupant(int32 X, int32 Y, UObject* Occupant);
+	bool ClearPlacementOccupantByHandle(FPlacementHandle Handle);
+	//Called once a batch of occupancy changes has been made so that they can be sent out.
+	void NotifyPlacementOccupancyChanged();
+
+	void OnReceivedOccupancyUpdate(const FPlacementOccupancyRow& OccupancyRow);
+
 	uint8 GetPlacementType() const { return PlacementType; }
 
 	UFUNCTION(BlueprintCallable, Category = Placement, meta = (DisplayName = "Get Placement Type", ScriptName = "GetPlacementType"))
@@ -102,8 +112,15 @@ protected:
 	UPROPERTY()
 	FPlacementGrid PlacementGrid = FPlacementGrid();
 
+	//Compact occupancy of PlacementGrid so clients can validate placement previews locally. Only used by the parentmost placement actor.
+	UPROPERTY(Replicated, Transient)
+	FPlacementOccupancyContainer PlacementOccupancy = FPlacementOccupancyContainer();
+
 	UPROPERTY(EditInstanceOnly, Category = Generation)
 	TSoftObjectPtr<APlacementActor> ParentPlacementActor = nullptr;
+	//Resolved on BeginPlay so that GetParentmostPlacementActor does not need to walk the parent chain during play.
+	UPROPERTY(Transient)
+	TWeakObjectPtr<APlacementActor> CachedParentmostPlacementActor = nullptr;
 
 	UPROPERTY(Transient)
 	TSubclassOf<UPlacementMarkerComponent> PlacementMarkerClass = nullptr;
@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Overlord/TrapTypes.h"
+#include "NauseaNetDefines.h"
 #include "PlacementTypes.generated.h"
 
+class APlacementActor;
+
 UENUM(BlueprintType)
 enum class EPlacementResult : uint8
 {
@@ -201,8 +204,9 @@ public:
 		: Handle(MoveTemp(InHandle)) {}
 
 	bool IsValid() const { return Handle.IsValid(); }
-	bool IsOccupied() const { return Occupant.IsValid(); }
+	bool IsOccupied() const { return Occupant.IsValid() || bReplicatedOccupied; }
 	void SetOccupant(UObject* InOccupant) { Occupant = InOccupant; }
+	void SetReplicatedOccupied(bool bInReplicatedOccupied) { bReplicatedOccupied = bInReplicatedOccupied; }
 
 	FPlacementHandle GetHandle() const { return Handle; }
 
@@ -213,6 +217,9 @@ private:
 	FPlacementHandle Handle = FPlacementHandle();
 	UPROPERTY(Transient)
 	TWeakObjectPtr<UObject> Occupant = nullptr;
+	//Occupancy received from the server via FPlacementOccupancyContainer. Occupants themselves are not known to clients.
+	UPROPERTY(Transient)
+	bool bReplicatedOccupied = false;
 };
 
 USTRUCT()
@@ -266,6 +273,22 @@ public:
 		return true;
 	}
 
+	FORCEINLINE bool SetReplicatedOccupied(int32 X, bool bOccupied)
+	{
+		if (X < 0)
+		{
+			return false;
+		}
+
+		if (Row.Num() <= X)
+		{
+			return false;
+		}
+
+		Row[X].SetReplicatedOccupied(bOccupied);
+		return true;
+	}
+
 	FORCEINLINE bool Set(int32 X, const FPlacementPoint& InPoint)
 	{
 		if (X < 0)
@@ -292,6 +315,39 @@ protected:
 	TArray<FPlacementPoint> Row = TArray<FPlacementPoint>();
 };
 
+//Packed per-row availability of a placement grid (one bit per point). Lets footprints be evaluated for 64 anchors per word at once.
+struct NAUSEADUNGEON_API FPlacementAvailabilityMask
+{
+public:
+	FPlacementAvailabilityMask() {}
+
+	void Build(const TArray<FPlacementGridRow>& RowList, int32 InSizeX, bool bMustBeEmpty);
+
+	FORCEINLINE bool IsDirty() const { return bDirty; }
+	FORCEINLINE void MarkDirty() { bDirty = true; }
+
+	FORCEINLINE int32 GetWordsPerRow() const { return WordsPerRow; }
+
+	//Returns true if Count points starting at StartX in row Y are all available.
+	bool IsRangeAvailable(int32 StartX, int32 Y, int32 Count) const;
+
+	//Fills OutAnchorMask with a bit for every anchor (bottom left point) in rows MinY through MaxY whose FootprintSizeX by FootprintSizeY
+	//footprint is entirely available. OutAnchorMask is laid out with GetWordsPerRow() words per row, starting at MinY.
+	void GetValidAnchors(int32 FootprintSizeX, int32 FootprintSizeY, int32 MinY, int32 MaxY, TArray<uint64>& OutAnchorMask) const;
+
+	FORCEINLINE static bool IsBitSet(const uint64* Row, int32 X) { return ((Row[X >> 6] >> (X & 63)) & 1) != 0; }
+
+protected:
+	//Performs Destination[X] &= Source[X + Shift] across a row of words. Safe to use in place.
+	static void AndShiftedRight(uint64* Destination, const uint64* Source, int32 WordCount, int32 Shift);
+
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	int32 WordsPerRow = 0;
+	TArray<uint64> Bits;
+	bool bDirty = true;
+};
+
 USTRUCT()
 struct FPlacementGrid
 {
@@ -350,6 +406,7 @@ public:
 
 	FORCEINLINE void SetSize(int32 SizeX, int32 SizeY)
 	{
+		MarkAvailabilityDirty();
 		RowList.SetNum(SizeY);
 		for (FPlacementGridRow& Row : RowList)
 		{
@@ -367,6 +424,8 @@ public:
 
 	FORCEINLINE bool Set(int32 X, int32 Y, const FPlacementPoint& InPoint)
 	{
+		MarkAvailabilityDirty();
+
 		if (Y >= RowList.Num())
 		{
 			RowList.SetNum(Y + 1);
@@ -387,9 +446,26 @@ public:
 			return false;
 		}
 
+		AvailabilityMaskList[1].MarkDirty();
 		return RowList[Y].SetOccupant(X, InOccupant);
 	}
 
+	FORCEINLINE bool SetReplicatedOccupied(int32 X, int32 Y, bool bOccupied)
+	{
+		if (!RowList.IsValidIndex(Y))
+		{
+			return false;
+		}
+
+		AvailabilityMaskList[1].MarkDirty();
+		return RowList[Y].SetReplicatedOccupied(X, bOccupied);
+	}
+
+	FORCEINLINE const FPlacementCoordinates* FindCoordinatesByHandle(FPlacementHandle InHandle) const
+	{
+		return InHandle.IsValid() ? PlacementHandleMap.Find(InHandle) : nullptr;
+	}
+
 	FORCEINLINE bool ClearPlacementOccupantByHandle(FPlacementHandle InHandle)
 	{
 		if (!InHandle.IsValid() || !PlacementHandleMap.Contains(InHandle))
@@ -404,6 +480,7 @@ public:
 			return false;
 		}
 
+		AvailabilityMaskList[1].MarkDirty();
 		return RowList[Coordinates.GetY()].SetOccupant(Coordinates.GetX(), nullptr);
 	}
 
@@ -421,6 +498,15 @@ public:
 
 	void AddPointFromWorldPosition(const FVector& WorldPosition);
 
+	//Resolves the point at a world position if it lies within PlaneTolerance of this grid's plane. OutPlaneDistance is the absolute distance from the plane.
+	bool GetCoordinatesAtWorldPosition(const FVector& WorldPosition, float PlaneTolerance, FPlacementCoordinates& OutCoordinates, float& OutPlaneDistance) const;
+
+	//World space bounds of this grid's points.
+	FBox GetWorldBounds() const;
+
+	//Intersects a world space ray with the front face of this grid's plane. Returns false if the ray misses or lands outside of a valid point.
+	bool GetRayIntersection(const FVector& RayOrigin, const FVector& RayDirection, FVector& OutWorldPosition) const;
+
 	FORCEINLINE bool IsValidPoint(const FPlacementCoordinates& Coordinates, bool bMustBeEmpty) const
 	{
 		return Contains(Coordinates) && (!bMustBeEmpty || !Get(Coordinates).IsOccupied());
@@ -442,6 +528,12 @@ public:
 
 	bool AdjustAnchorToValidPoint(UWorld* World, FPlacementCoordinates& Coordinates, EPlacementAnchor AnchorType, int32 SizeX, int32 SizeY, bool bMustBeEmpty) const;
 
+	//Evaluates every anchor within MaxDistance of Coordinates at once and returns the valid one nearest to it.
+	bool FindNearestValidPlacement(const FPlacementCoordinates& Coordinates, int32 SizeX, int32 SizeY, bool bMustBeEmpty, int32 MaxDistance, FPlacementCoordinates& OutCoordinates) const;
+
+	const FPlacementAvailabilityMask& GetAvailabilityMask(bool bMustBeEmpty) const;
+	FORCEINLINE void MarkAvailabilityDirty() { AvailabilityMaskList[0].MarkDirty(); AvailabilityMaskList[1].MarkDirty(); }
+
 	bool CanMergeWith(const FPlacementGrid& InGrid) const;
 	bool Append(const FPlacementGrid& InGrid);
 	void RecalculateHandleMap();
@@ -463,4 +555,118 @@ protected:
 
 	UPROPERTY(Transient)
 	mutable bool bDebugDrawPlacementEnabled = false;
+
+	//Lazily built availability masks. Index 1 additionally excludes occupied points.
+	mutable FPlacementAvailabilityMask AvailabilityMaskList[2];
+};
+
+//World-level spatial index of parentmost placement actors. Buckets grid bounds into a uniform 2D (XY) cell map so a world position
+//resolves to its owning placement actor and grid coordinates without walking every placement actor in the world.
+struct NAUSEADUNGEON_API FPlacementSpatialIndex
+{
+public:
+	FPlacementSpatialIndex() {}
+
+	void Add(APlacementActor* PlacementActor);
+	void Remove(APlacementActor* PlacementActor);
+	void Reset();
+
+	int32 Num() const { return EntryList.Num(); }
+
+	//Returns the placement actor whose grid contains a point at WorldPosition (the nearest by plane distance if several do).
+	APlacementActor* FindPlacementActor(const FVector& WorldPosition, FPlacementCoordinates& OutCoordinates, float PlaneTolerance = TrapGridSize * 0.5f) const;
+	//Gathers every placement actor whose grid bounds overlap the given box.
+	void GetPlacementActorsInBox(const FBox& Box, TArray<APlacementActor*>& OutPlacementActorList) const;
+
+	static const float CellSize;
+
+protected:
+	FORCEINLINE static FIntPoint GetCellKey(float X, float Y)
+	{
+		return FIntPoint(FMath::FloorToInt(X / CellSize), FMath::FloorToInt(Y / CellSize));
+	}
+
+	struct FEntry
+	{
+		TWeakObjectPtr<APlacementActor> PlacementActor = nullptr;
+		FBox Bounds = FBox(ForceInit);
+	};
+
+	TSparseArray<FEntry> EntryList;
+	TMap<const APlacementActor*, int32> EntryIndexMap;
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> CellMap;
 };
+
+//Packed occupancy of a single placement grid row. Each bit represents a column of the row.
+USTRUCT()
+struct FPlacementOccupancyRow : public FFastArraySerializerItem
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	FPlacementOccupancyRow() {}
+
+	FPlacementOccupancyRow(int32 InRowIndex)
+		: RowIndex(InRowIndex) {}
+
+	FORCEINLINE int32 GetRowIndex() const { return RowIndex; }
+	FORCEINLINE int32 GetMaxColumns() const { return OccupancyBits.Num() * 8; }
+
+	FORCEINLINE bool IsOccupied(int32 X) const
+	{
+		const int32 ByteIndex = X >> 3;
+		return X >= 0 && OccupancyBits.IsValidIndex(ByteIndex) && (OccupancyBits[ByteIndex] & (1 << (X & 7))) != 0;
+	}
+
+	//Returns true if the occupancy of the given column changed.
+	bool SetOccupied(int32 X, bool bOccupied);
+
+protected:
+	UPROPERTY()
+	int32 RowIndex = INDEX_NONE;
+
+	UPROPERTY()
+	TArray<uint8> OccupancyBits = TArray<uint8>();
+};
+
+//Replicates the occupancy of a placement grid as per-row bitsets. Only rows that change are sent.
+USTRUCT()
+struct FPlacementOccupancyContainer : public FFastArraySerializer
+{
+	GENERATED_USTRUCT_BODY()
+
+	FAST_ARRAY_SERIALIZER_OPERATORS(FPlacementOccupancyRow, InstanceList);
+
+public:
+	FPlacementOccupancyContainer() {}
+
+	FORCEINLINE void SetOwningPlacementActor(APlacementActor* InOwningPlacementActor) { OwningPlacementActor = InOwningPlacementActor; }
+
+	//Returns true if occupancy changed (and the relevant row was marked dirty).
+	bool SetOccupied(int32 X, int32 Y, bool bOccupied);
+
+protected:
+	UPROPERTY()
+	TArray<FPlacementOccupancyRow> InstanceList;
+
+	UPROPERTY(Transient, NotReplicated)
+	APlacementActor* OwningPlacementActor = nullptr;
+
+public:
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FPlacementOccupancyRow, FPlacementOccupancyContainer>(InstanceList, DeltaParms, *this);
+	}
+
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+	void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
+};
+
+template<>
+struct TStructOpsTypeTraits< FPlacementOccupancyContainer > : public TStructOpsTypeTraitsBase2< FPlacementOccupancyContainer >
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
\ No newline at end of file
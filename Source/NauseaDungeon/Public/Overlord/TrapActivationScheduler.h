@@ -0,0 +1,75 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "TrapActivationScheduler.generated.h"
+
+class ATrapBase;
+
+DECLARE_STATS_GROUP(TEXT("TrapActivationScheduler"), STATGROUP_TrapActivationScheduler, STATCAT_Advanced);
+
+/**
+ * Activates every natively activated trap in a world. Trap cooldowns share a single timing wheel and all traps that
+ * come due on the same frame are activated together in one pass, sorted by trap class.
+ */
+UCLASS()
+class NAUSEADUNGEON_API UTrapActivationScheduler : public UObject, public FTickableGameObject
+{
+	GENERATED_UCLASS_BODY()
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend struct FTrapActivationSchedulerTestHelper;
+#endif //WITH_DEV_AUTOMATION_TESTS
+
+//~ Begin FTickableGameObject Interface
+protected:
+	virtual void Tick(float DeltaTime) override;
+public:
+	virtual ETickableTickType GetTickableTickType() const override { return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return !IsPendingKill() && EntryList.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UTrapActivationScheduler, STATGROUP_TrapActivationScheduler); }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+//~ End FTickableGameObject Interface
+
+public:
+	static UTrapActivationScheduler* Get(const UObject* WorldContextObject);
+
+	void RegisterTrap(ATrapBase* Trap);
+	void UnregisterTrap(ATrapBase* Trap);
+
+	int32 Num() const { return EntryList.Num(); }
+
+	//Seconds covered by a single wheel slot.
+	static const float SlotDuration;
+	static const int32 WheelSize;
+
+protected:
+	int64 GetTickForTime(float WorldTime) const { return FMath::FloorToInt(WorldTime / SlotDuration); }
+
+	void Schedule(int32 EntryIndex, float Delay);
+	void RemoveEntry(int32 EntryIndex);
+	void ActivateDueTraps();
+
+	struct FTrapActivationEntry
+	{
+		TWeakObjectPtr<ATrapBase> Trap = nullptr;
+		//Key into EntryIndexMap. Never dereferenced, it is only kept so the entry can be removed after the trap has been collected.
+		const ATrapBase* TrapKey = nullptr;
+		const UClass* TrapClass = nullptr;
+		int64 DueTick = 0;
+		int32 SlotIndex = INDEX_NONE;
+	};
+
+	TSparseArray<FTrapActivationEntry> EntryList;
+	TMap<const ATrapBase*, int32> EntryIndexMap;
+
+	//Each slot holds the entries whose due tick maps onto it. Entries more than one revolution out stay put until their tick comes around.
+	TArray<TArray<int32>> Wheel;
+	//Last tick the wheel has advanced to. Resynced to the world clock whenever a trap registers into an empty wheel.
+	int64 CurrentTick = 0;
+
+	TArray<int32> DueEntryList;
+};
\ No newline at end of file
@@ -15,9 +15,15 @@ class NAUSEADUNGEON_API ATrapBase : public AActor
 {
 	GENERATED_UCLASS_BODY()
 
+#if WITH_DEV_AUTOMATION_TESTS
+	friend struct FTrapActivationSchedulerTestHelper;
+#endif //WITH_DEV_AUTOMATION_TESTS
+
 //~ Begin AActor Interface
 public:
 	virtual void PostInitializeComponents() override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 //~ End AActor Interface
 
 public:
@@ -54,12 +60,35 @@ public:
 	void SetOccupancy(APlacementActor* TargetPlacementActor, const FPlacementCoordinates& BottomLeftCorner, const FPlacementCoordinates& TopRightCorner);
 	void RevokeOccupancy();
 
+	UFUNCTION(BlueprintCallable, Category = Activation)
+	const FTrapActivationSettings& GetActivationSettings() const { return ActivationSettings; }
+	UFUNCTION(BlueprintCallable, Category = Activation)
+	UPrimitiveComponent* GetActivationComponent() const { return ActivationComponent; }
+
+	//Called by UTrapActivationScheduler once this trap's cooldown has elapsed. bMayHaveTargets is false if the scheduler
+	//found no pawns near the activation component, in which case the overlap test is skipped. Returns false if the trigger condition was not met.
+	virtual bool TryActivate(bool bMayHaveTargets);
+
+	//Controller of the player who placed this trap.
+	AController* GetTrapInstigatorController() const;
+
+	//Traps are net dormant while idle. Must be called on the server before changing replicated state (trigger, upgrade, etc.) so that the change is sent.
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = Trap)
+	void NotifyTrapStateChanged();
+
 protected:
 	UFUNCTION(BlueprintCallable, Category = Trap, meta = (AutoCreateRefTerm = "ActorsToIgnore"))
 	TArray<AActor*> PerformOverlapTestWithPrimitive(UPrimitiveComponent* Component, TSubclassOf<AActor> ActorClassFilter, TArray<AActor*> ActorsToIgnore);
 	UFUNCTION(BlueprintCallable, Category = Trap, meta = (AutoCreateRefTerm = "ActorsToIgnore"))
 	TArray<AActor*> PerformOverlapTestWithPrimitiveAndApplyDamage(UPrimitiveComponent* Component, TSubclassOf<AActor> ActorClassFilter, TArray<AActor*> ActorsToIgnore);
 
+	//Applies ActivationSettings' damage to each actor in the list.
+	void ApplyActivationDamage(const TArray<AActor*>& ActorList);
+
+	//Only wakes the trap from dormancy if something was hit. Implementations that change replicated state on an empty activation must call NotifyTrapStateChanged first.
+	UFUNCTION(BlueprintImplementableEvent, Category = Activation, meta = (DisplayName = "On Trap Activated"))
+	void K2_OnTrapActivated(const TArray<AActor*>& HitActorList);
+
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = Trap)
 	int32 Cost = 100;
@@ -78,6 +107,11 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = UI)
 	TSoftObjectPtr<UTexture2D> TrapIcon = nullptr;
 
+	UPROPERTY(EditDefaultsOnly, Category = Activation)
+	FTrapActivationSettings ActivationSettings = FTrapActivationSettings();
+	UPROPERTY(Transient)
+	UPrimitiveComponent* ActivationComponent = nullptr;
+
 
 	UPROPERTY(Transient)
 	TWeakObjectPtr<APlacementActor> OccupiedPlacementActor = nullptr;
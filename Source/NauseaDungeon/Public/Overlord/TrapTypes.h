@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "TrapTypes.generated.h"
 
+class UCoreDamageType;
+
 const static float TrapGridSize = 100.f;
 
 UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
@@ -13,4 +15,48 @@ enum class EPlacementType : uint8
 	Wall = 1 << 2,
 	Ceiling = 1 << 3
 };
-ENUM_CLASS_FLAGS(EPlacementType);
\ No newline at end of file
+ENUM_CLASS_FLAGS(EPlacementType);
+
+UENUM(BlueprintType)
+enum class ETrapTriggerCondition : uint8
+{
+	Periodic, //Activates every cooldown, regardless of whether anything is in range.
+	PawnInRange, //Activates only when a dungeon pawn overlaps the activation component.
+	MAX = 255 UMETA(Hidden)
+};
+
+USTRUCT(BlueprintType)
+struct FTrapActivationSettings
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+	FTrapActivationSettings() {}
+
+	//If true, this trap is activated by the world's UTrapActivationScheduler instead of driving its own timers.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	bool bUseNativeActivation = false;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (EditCondition = bUseNativeActivation))
+	ETrapTriggerCondition TriggerCondition = ETrapTriggerCondition::PawnInRange;
+
+	//Time between activations.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (EditCondition = bUseNativeActivation, ClampMin = "0.0"))
+	float Cooldown = 1.f;
+	//Delay before the first activation once the trap has begun play.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (EditCondition = bUseNativeActivation, ClampMin = "0.0"))
+	float InitialDelay = 0.f;
+	//How long to wait before checking the trigger condition again after it was not met.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (EditCondition = bUseNativeActivation, ClampMin = "0.0"))
+	float TriggerCheckInterval = 0.1f;
+
+	//Name of the primitive component whose collision shape is used for activation overlaps. If none, the root component is used.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	FName ActivationComponentName = NAME_None;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	TSubclassOf<UCoreDamageType> DamageType = nullptr;
+	//Damage applied to each overlapping actor per activation. If negative, the damage type's damage amount is used.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	float Damage = -1.f;
+};
\ No newline at end of file
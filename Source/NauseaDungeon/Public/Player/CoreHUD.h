@@ -13,6 +13,8 @@ class ACorePlayerState;
 class UPlayerClassComponent;
 class UPromptInfo;
 class UWidget;
+class UCoreUserWidget;
+class SWidget;
 
 USTRUCT()
 struct FWidgetPool
@@ -22,12 +24,18 @@ struct FWidgetPool
 	FWidgetPool() {}
 
 public:
-	void PushWidget(UWidget* Widget) { Pool.Push(Widget); }
-	UWidget* PopWidget() { return Pool.Num() > 0 ? Pool.Pop(false) : nullptr; }
+	void PushWidget(UWidget* Widget);
+	UWidget* PopWidget();
+
+	bool Contains(const UWidget* Widget) const { return CachedSlateWidgetMap.Contains(Widget); }
+	int32 Num() const { return Pool.Num(); }
 
 protected:
 	UPROPERTY()
 	TArray<UWidget*> Pool;
+
+	//Keeps the Slate widget of each pooled widget alive so reusing it does not rebuild its Slate tree.
+	TMap<const UWidget*, TSharedPtr<SWidget>> CachedSlateWidgetMap;
 };
 
 
@@ -42,6 +50,8 @@ class ACoreHUD : public AHUD
 //~ Begin AActor Interface
 public:
 	virtual void PostInitializeComponents() override;
+protected:
+	virtual void BeginPlay() override;
 //~ End AActor Interface
 
 public:
@@ -50,6 +60,13 @@ public:
 
 	void ReleaseWidgetToPool(UWidget* Widget);
 
+	//Returns a pooled widget of the given class (notifying it that it was acquired) or nullptr if none are pooled.
+	UCoreUserWidget* AcquireWidgetFromPool(TSubclassOf<UCoreUserWidget> WidgetClass);
+
+	//Returns a pooled widget of the given class, creating one if none are pooled.
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = HUD, meta = (DeterminesOutputType = "WidgetClass"))
+	UCoreUserWidget* AcquireWidget(TSubclassOf<UCoreUserWidget> WidgetClass);
+
 	template<class TWidgetClass>
 	TWidgetClass* GetWidgetFromPool(TSubclassOf<UWidget> WidgetClass)
 	{
@@ -80,6 +97,13 @@ protected:
 	UFUNCTION()
 	void ReceivedPlayerPrompt(const FPromptHandle& PromptHandle);
 
+	void PrewarmWidgetPool();
+
+protected:
+	//Number of widgets of each class to create up front so that world space health bars, status icons, etc. do not need to be constructed during gameplay.
+	UPROPERTY(EditDefaultsOnly, Category = HUD)
+	TMap<TSubclassOf<UCoreUserWidget>, int32> WidgetPoolPrewarmMap;
+
 private:
 	UPROPERTY(Transient)
 	TMap<TSubclassOf<UWidget>, FWidgetPool> WidgetPool;
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Player/CorePlayerController.h"
+#include "Engine/StreamableManager.h"
 #include "DungeonPlayerController.generated.h"
 
 class ATrapBase;
@@ -40,12 +41,29 @@ public:
 
 	const ATrapBase* GetPlacementTrapCDO() const;
 
+	UFUNCTION(BlueprintCallable, Category = Placement)
+	const TArray<TSoftClassPtr<ATrapBase>>& GetTrapLoadout() const { return TrapLoadout; }
+
 	void SetPlacementEnabled(bool bEnabled);
 
 protected:
 	UFUNCTION()
 	void OnMatchStateChanged(ACoreGameState* GameState, FName MatchState);
 
+	//Returns true if the cursor, view, selected trap or rotation changed since the last placement update (or a refresh is due).
+	bool ShouldUpdatePlacement();
+	//Resolves the placement location under the cursor. Intersects the last hovered placement grid directly before falling back to a placement trace.
+	bool GetPlacementHitResult(FHitResult& HitResult);
+	void MarkPlacementDirty() { bPlacementUpdatePending = true; }
+
+	//Async loads every trap class in TrapLoadout followed by their preview classes so that selecting a trap never blocks.
+	void PreloadTrapLoadout();
+	void OnTrapLoadoutLoaded();
+	void RequestPlacementTrapPreviewClass(const TSoftClassPtr<ATrapPreview>& SoftPreviewClass);
+	void OnPlacementTrapPreviewClassLoaded();
+	//Resolves PlacementTrapPreviewClass from the current trap class and destroys the current preview actor if it no longer matches.
+	void ResolvePlacementTrapPreviewClass();
+
 	bool UpdatePlacement(const FHitResult& HitResult, FTransform& PlacementTransform);
 	void UpdatePreviewActor(bool bActive, const FTransform& PlacementTransform, APlacementActor* PlacementActor);
 
@@ -65,6 +83,13 @@ protected:
 	UPROPERTY()
 	uint8 Rotation = 0;
 
+	//Trap classes available to this player. Loaded asynchronously (along with their previews) when the build phase starts.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Placement)
+	TArray<TSoftClassPtr<ATrapBase>> TrapLoadout;
+	//Preview shown while the selected trap's preview class is still loading.
+	UPROPERTY(EditDefaultsOnly, Category = Placement)
+	TSubclassOf<ATrapPreview> PlaceholderTrapPreviewClass = nullptr;
+
 	UPROPERTY(Transient)
 	TSubclassOf<ATrapBase> PlacementTrapClass = nullptr;
 	UPROPERTY(Transient)
@@ -74,6 +99,27 @@ protected:
 	UPROPERTY(Transient)
 	bool bPlacementEnabled = false;
 
+	UPROPERTY(Transient)
+	TWeakObjectPtr<APlacementActor> LastPlacementActor = nullptr;
+	UPROPERTY(Transient)
+	TSubclassOf<ATrapBase> LastPlacementUpdateTrapClass = nullptr;
+	UPROPERTY(Transient)
+	uint8 LastPlacementUpdateRotation = 0;
+	UPROPERTY(Transient)
+	FVector2D LastPlacementMousePosition = FVector2D(-1.f);
+	UPROPERTY(Transient)
+	FVector LastPlacementViewLocation = FVector::ZeroVector;
+	UPROPERTY(Transient)
+	FRotator LastPlacementViewRotation = FRotator::ZeroRotator;
+	UPROPERTY(Transient)
+	float LastPlacementUpdateTime = -1.f;
+	UPROPERTY(Transient)
+	bool bPlacementUpdatePending = true;
+
+	TSharedPtr<FStreamableHandle> TrapLoadoutStreamableHandle;
+	TSharedPtr<FStreamableHandle> TrapPreviewStreamableHandle;
+	TSharedPtr<FStreamableHandle> PlacementTrapPreviewStreamableHandle;
+
 public:
 	UFUNCTION(BlueprintCallable, Category = Input)
 	static bool IsMouseEventMatchingActionEvent(const FPointerEvent& MouseEvent, FName InActionName);
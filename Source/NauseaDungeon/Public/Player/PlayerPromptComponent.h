@@ -7,6 +7,27 @@
 #include "Player/PlayerPrompt/PlayerPromptTypes.h"
 #include "PlayerPromptComponent.generated.h"
 
+struct FPromptHeapEntry
+{
+	FPromptHeapEntry() {}
+	FPromptHeapEntry(const FPromptData& PromptData)
+		: PromptHandle(PromptData.GetPromptHandle()), Priority(PromptData.GetPriority()) {}
+
+	FPromptHandle PromptHandle = FPromptHandle::InvalidHandle;
+	uint8 Priority = 0;
+
+	//Matches FPromptData::operator>. Higher priority first, then older prompts first.
+	bool operator<(const FPromptHeapEntry& Other) const
+	{
+		if (Priority == Other.Priority)
+		{
+			return PromptHandle < Other.PromptHandle;
+		}
+
+		return Priority > Other.Priority;
+	}
+};
+
 USTRUCT()
 struct  FPromptStack
 {
@@ -28,7 +49,25 @@ public:
 	FPromptData& GetTopDataMutable();
 
 private:
-	TMap<FPromptHandle, FPromptData> PromptMap = TMap<FPromptHandle, FPromptData>();
+	void AddPrompt(FPromptData&& PromptData);
+	void RemovePrompt(const FPromptHandle& PromptHandle);
+	//Discards popped prompts from the top of the heap and caches the index of the new top prompt.
+	void UpdateTopPrompt();
+	//Rebuilds PromptHeap from PromptList, dropping all stale entries.
+	void RebuildPromptHeap();
+
+private:
+	//Dense prompt storage. Indices are not stable, use PromptIndexMap to look prompts up by handle.
+	TArray<FPromptData> PromptList = TArray<FPromptData>();
+	TMap<FPromptHandle, int32> PromptIndexMap = TMap<FPromptHandle, int32>();
+
+	//Priority heap of prompt handles. Popped prompts are removed lazily once they reach the top, or all at once when the heap is rebuilt.
+	TArray<FPromptHeapEntry> PromptHeap = TArray<FPromptHeapEntry>();
+
+	//Prompt currently in the stack for each prompt info class that does not allow duplicates.
+	TMap<TSubclassOf<UPromptInfo>, FPromptHandle> UniquePromptMap = TMap<TSubclassOf<UPromptInfo>, FPromptHandle>();
+
+	int32 TopPromptIndex = INDEX_NONE;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRequestDisplayPromptSignature, const FPromptHandle&, PromptHandle);
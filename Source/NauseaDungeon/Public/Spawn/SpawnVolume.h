@@ -53,6 +53,18 @@ public:
 	void Enable() { bEnabled = true; }
 	void Disable() { bEnabled = false; }
 
+	FORCEINLINE bool IsOccupied() const { return bOccupied; }
+	void SetOccupied(bool bInOccupied) { bOccupied = bInOccupied; }
+
+	FORCEINLINE bool HasBeenValidated() const { return bHasBeenValidated; }
+	void MarkValidated() { bHasBeenValidated = true; }
+
+	FORCEINLINE bool IsValidationPending() const { return bValidationPending; }
+	void SetValidationPending(bool bInValidationPending) { bValidationPending = bInValidationPending; }
+
+	FORCEINLINE bool IsInReadyList() const { return bInReadyList; }
+	void SetInReadyList(bool bInInReadyList) { bInReadyList = bInInReadyList; }
+
 protected:
 	UPROPERTY(Transient)
 	float MostRecentUseTime = -MAX_FLT;
@@ -60,6 +72,19 @@ protected:
 	float MostRecentFailureTime = -MAX_FLT;
 	UPROPERTY(Transient)
 	bool bEnabled = true;
+
+	//Result of the most recent occupancy test. Locations start occupied until they have been validated once.
+	UPROPERTY(Transient)
+	bool bOccupied = true;
+	//Has this location received at least one occupancy test result.
+	UPROPERTY(Transient)
+	bool bHasBeenValidated = false;
+	//Is there an occupancy test in flight for this location.
+	UPROPERTY(Transient)
+	bool bValidationPending = false;
+	//Is this location currently in the owning volume's ready list.
+	UPROPERTY(Transient)
+	bool bInReadyList = false;
 };
 
 /**
@@ -73,6 +98,7 @@ class NAUSEADUNGEON_API ASpawnVolume : public AVolume, public ISpawnLocationInte
 //~ Begin AActor Interface
 public:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 //~ End AActor Interface
 
 #if WITH_EDITOR
@@ -95,12 +121,26 @@ public:
 	virtual bool HasAvailableSpawnTransform(TSubclassOf<ACoreCharacter> CoreCharacter) const;
 //~ End ISpawnLocationInterface Interface
 
+protected:
+	//Issues asynchronous occupancy tests for every spawn location that does not already have one in flight.
+	UFUNCTION()
+	void ValidateSpawnLocations();
+	void OnSpawnLocationValidated(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapDatum, int32 Index);
+
+	//Performs a blocking occupancy test at the given spawn location using the larger of its cylinder and the given extent.
+	bool IsSpawnLocationClear(int32 Index, const FVector2D& RequiredExtent) const;
+	//Synchronously tests spawn locations that have not received an occupancy result yet. Used when a spawn is requested before the first asynchronous pass returns.
+	int32 FindUnvalidatedSpawnLocation(const FVector2D& RequiredExtent);
+
+	void AddToReadyList(int32 Index);
+	void RemoveFromReadyList(int32 Index);
+
 protected:
 	//If larger than 0, will limit the amount of spawn locations this volume will generate.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = SpawnVolume)
 	int32 MaxSpawnLocations = -1;
 
-	//Radius of a given spawn location.
+	//Radius of a given spawn location. Background occupancy tests use this extent. Characters with a larger capsule are additionally tested against their own capsule when a location is handed out.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = SpawnVolume)
 	float SpawnLocationRadius = 48.f;
 
@@ -119,6 +159,21 @@ protected:
 	UPROPERTY(Transient)
 	TArray<FSpawnLocationStatusData> SpawnLocationStatusList;
 
+	//How often spawn locations are tested for occupancy in the background.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = SpawnVolume, meta = (ClampMin = "0.05"))
+	float SpawnValidationInterval = 0.25f;
+
+	//Indices of spawn locations that were unoccupied on their most recent occupancy test and are not cooling down.
+	UPROPERTY(Transient)
+	TArray<int32> ReadySpawnLocationList;
+
+	UPROPERTY(Transient)
+	FTimerHandle SpawnValidationTimerHandle;
+
+	//Number of spawn locations that have not received an occupancy test result yet.
+	UPROPERTY(Transient)
+	int32 UnvalidatedSpawnLocationCount = 0;
+
 #if WITH_EDITOR
 protected:
 	UFUNCTION(CallInEditor, Category = SpawnVolume)
@@ -28,7 +28,8 @@ class UCoreSingleton : public UObject, public FTickableGameObject
 protected:
 	virtual void Tick(float DeltaTime) override;
 public:
-	virtual ETickableTickType GetTickableTickType() const { return ETickableTickType::Always; }
+	//Only GEngine->GameSingleton ticks. The CDO must not, or FGameThreadCommandQueue would be drained twice per frame.
+	virtual ETickableTickType GetTickableTickType() const { return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Always; }
 	virtual bool IsTickable() const { return !IsPendingKill(); }
 	virtual TStatId GetStatId() const { return TStatId(); }
 	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
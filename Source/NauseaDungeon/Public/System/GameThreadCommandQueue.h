@@ -0,0 +1,62 @@
+// Copyright 2020-2022 Heavy Mettle Interactive. Published under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Async/Async.h"
+
+/**
+ * Bounded multi-producer single-consumer queue of commands to be run on the game thread.
+ * Any thread may enqueue. The queue is drained once per frame by UCoreSingleton::Tick within a time budget.
+ */
+class NAUSEADUNGEON_API FGameThreadCommandQueue
+{
+public:
+	static FGameThreadCommandQueue& Get();
+
+	//Thread safe. If the queue is full, the command is handed to the task graph's game thread queue instead so it is never dropped.
+	void Enqueue(TUniqueFunction<void()>&& Command);
+
+	//Game thread only. Runs queued commands until the queue is empty or the budget is spent. Returns the number of commands run.
+	int32 Drain(double TimeBudgetSeconds);
+
+	int32 Num() const { return QueuedCommandCount.GetValue(); }
+	static constexpr int32 GetMaxQueuedCommands() { return MaxQueuedCommands; }
+
+	static double GetDrainTimeBudget();
+
+	//Runs Work on a background task graph thread and queues Continuation with its result on the game thread.
+	template<typename ResultType>
+	static void Dispatch(TUniqueFunction<ResultType()>&& Work, TUniqueFunction<void(ResultType&&)>&& Continuation)
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Work = MoveTemp(Work), Continuation = MoveTemp(Continuation)]() mutable
+		{
+			ResultType Result = Work();
+			FGameThreadCommandQueue::Get().Enqueue([Continuation = MoveTemp(Continuation), Result = MoveTemp(Result)]() mutable
+			{
+				Continuation(MoveTemp(Result));
+			});
+		});
+	}
+
+	//Same as above, but Continuation is skipped if Owner has been destroyed by the time it is run.
+	template<typename ResultType>
+	static void Dispatch(const UObject* Owner, TUniqueFunction<ResultType()>&& Work, TUniqueFunction<void(ResultType&&)>&& Continuation)
+	{
+		TWeakObjectPtr<const UObject> WeakOwner = Owner;
+		Dispatch<ResultType>(MoveTemp(Work), [WeakOwner, Continuation = MoveTemp(Continuation)](ResultType&& Result) mutable
+		{
+			if (WeakOwner.IsValid())
+			{
+				Continuation(MoveTemp(Result));
+			}
+		});
+	}
+
+private:
+	static const int32 MaxQueuedCommands = 4096;
+
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> CommandQueue;
+	FThreadSafeCounter QueuedCommandCount;
+};
\ No newline at end of file
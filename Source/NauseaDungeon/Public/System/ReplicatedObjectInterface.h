@@ -4,10 +4,19 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "ReplicatedObjectInterface.generated.h"
 
 class UActorChannel;
 
+//Marks a push model property dirty and bumps the owning IReplicatedObjectInterface's dirty generation so that ReplicateSubobjects does not skip it.
+#define MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME(ClassName, PropertyName, Object) \
+	do \
+	{ \
+		MARK_PROPERTY_DIRTY_FROM_NAME(ClassName, PropertyName, Object); \
+		IReplicatedObjectInterface::MarkObjectReplicationDirty(Object); \
+	} while (0)
+
 UENUM(BlueprintType)
 enum class ESkipReplicationLogic : uint8
 {
@@ -53,9 +62,32 @@ public:
 
 	FORCEINLINE bool UnregisterReplicatedSubobject(UObject* Subobject);
 	FORCEINLINE bool ClearReplicatedSubobjectList();
-	
+
+	//Objects that use dirty generations are skipped by ReplicateSubobjects for a channel if nothing was marked dirty since they were last replicated to it.
+	//All of their replicated properties must be push model and marked via MARK_REPLICATED_PROPERTY_DIRTY_FROM_NAME (or MarkReplicationDirty).
+	void SetUseReplicationDirtyGeneration(bool bInUseReplicationDirtyGeneration) { bReplicatedObjectInterfaceUseDirtyGeneration = bInUseReplicationDirtyGeneration; }
+	bool UsesReplicationDirtyGeneration() const;
+
+	//Bumps this object's dirty generation as well as the generation of the nearest outer IReplicatedObjectInterface (below the owning actor).
+	void MarkReplicationDirty();
+	static void MarkObjectReplicationDirty(UObject* Object);
+
+	bool ShouldReplicateForChannel(UActorChannel* OwnerActorChannel) const;
+	void NotifyReplicatedForChannel(UActorChannel* OwnerActorChannel);
 
 private:
 	ESkipReplicationLogic ReplicatedObjectInterfaceSkipReplicationLogic = ESkipReplicationLogic::None;
 	TArray<TWeakObjectPtr<UObject>> ReplicatedObjectInterfaceSubobjectList = TArray<TWeakObjectPtr<UObject>>();
+
+	struct FReplicatedObjectChannelRecord
+	{
+		uint32 DirtyGeneration = 0;
+		double LastReplicationTime = 0.0;
+	};
+
+	bool bReplicatedObjectInterfaceUseDirtyGeneration = false;
+	//Set if a subobject with non push model (i.e. blueprint) replicated properties was registered. Changes to those can't be tracked, so the object is always replicated.
+	bool bReplicatedObjectInterfaceHasUntrackedSubobject = false;
+	uint32 ReplicatedObjectInterfaceDirtyGeneration = 1;
+	TMap<TWeakObjectPtr<UActorChannel>, FReplicatedObjectChannelRecord> ReplicatedObjectInterfaceChannelRecordMap;
 };
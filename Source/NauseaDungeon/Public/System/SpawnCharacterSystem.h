@@ -78,6 +78,11 @@ UCLASS()
 class USpawnCharacterSystem : public UObject
 {
 	GENERATED_UCLASS_BODY()
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FSpawnCharacterSystemCancelRequestTest;
+	friend class FSpawnCharacterSystemRequestPerformanceTest;
+#endif //WITH_DEV_AUTOMATION_TESTS
 	
 public:
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = SpawnCharacterSystem)
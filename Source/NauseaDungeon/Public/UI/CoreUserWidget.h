@@ -16,6 +16,7 @@ class ACorePlayerState;
 class UPlayerClassComponent;
 class ACoreCharacter;
 class UCoreWidgetComponent;
+class ACoreHUD;
 
 /**
  * 
@@ -41,6 +42,8 @@ public:
 	void K2_SetWidgetMinimumDesiredSize(const FVector2D& InMinimumDesiredSize);
 
 	void ReleaseWidgetToPool();
+	//Called by ACoreHUD when this widget is handed out again from the widget pool.
+	void NotifyAcquiredFromPool();
 
 	void InitializeWidgetComponent(UCoreWidgetComponent* InCoreWidgetComponent);
 
@@ -67,6 +70,15 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category="Widget")
 	void OnWidgetReleasedToPool();
 
+	UFUNCTION(BlueprintImplementableEvent, Category="Widget")
+	void OnWidgetAcquiredFromPool();
+
+	//Pooled widgets keep their Slate tree, so overrides should only clear or rebind the data they display.
+	virtual void NativeOnReleasedToPool();
+	virtual void NativeOnAcquiredFromPool() {}
+
+	ACoreHUD* GetOwningCoreHUD() const;
+
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCosmetic, Category = "Widget")
 	void OnReceivedWidgetComponent(UCoreWidgetComponent* WidgetComponent);
 
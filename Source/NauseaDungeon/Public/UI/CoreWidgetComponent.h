@@ -6,6 +6,8 @@
 #include "Components/WidgetComponent.h"
 #include "CoreWidgetComponent.generated.h"
 
+class ACoreHUD;
+
 /**
  * 
  */
@@ -14,8 +16,21 @@ class NAUSEADUNGEON_API UCoreWidgetComponent : public UWidgetComponent
 {
 	GENERATED_UCLASS_BODY()
 	
+//~ Begin UActorComponent Interface
+public:
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+//~ End UActorComponent Interface
+
 //~ Begin UWidgetComponent Interface
 public:
 	virtual void InitWidget() override;
 //~ Begin UWidgetComponent Interface
+
+public:
+	ACoreHUD* GetOwningCoreHUD() const;
+
+protected:
+	//If true, this component's widget is taken from and returned to the owning player's ACoreHUD widget pool instead of being created and destroyed with the component.
+	UPROPERTY(EditDefaultsOnly, Category = UserInterface)
+	bool bUseWidgetPool = true;
 };
@@ -10,6 +10,8 @@
 class UStatusEffectBase;
 class UStatusEffectInstantBase;
 class UStatusEffectCumulativeBase;
+class UImage;
+class UMaterialInstanceDynamic;
 
 /**
  * 
@@ -24,12 +26,62 @@ public:
 	virtual void NativePreConstruct() override;
 //~ End UUserWidget Interface
 
+//~ Begin UCoreUserWidget Interface
+protected:
+	virtual void NativeOnReleasedToPool() override;
+//~ End UCoreUserWidget Interface
+
 public:
 	UStatusEffectBase* GetOwningStatusEffect() const { return StatusEffect; }
 
+	//Rebinds this widget to a different status effect. Used when reusing pooled widgets so their Slate tree does not need to be rebuilt.
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "Status Effect User Widget")
+	void SetStatusEffect(UStatusEffectBase* InStatusEffect);
+
+	//Acquires a status effect widget from the player's widget pool (creating one if the pool is empty) and binds it to the given status effect.
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category = "Status Effect User Widget", meta = (DeterminesOutputType = "WidgetClass"))
+	static UStatusEffectUserWidget* AcquireStatusEffectWidget(APlayerController* PlayerController, TSubclassOf<UStatusEffectUserWidget> WidgetClass, UStatusEffectBase* InStatusEffect);
+
 protected:
 	UFUNCTION()
 	virtual void ReceiveStatusEffectEnd(UStatusEffectBase* Status, EStatusEndType EndType) {}
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "Status Effect User Widget")
+	void OnStatusEffectChanged(UStatusEffectBase* InStatusEffect);
+
+	//Widgets should update their display from these events rather than from per-frame property bindings so that they are only invalidated when the status effect actually changes.
+	UFUNCTION(BlueprintImplementableEvent, Category = "Status Effect User Widget")
+	void OnStatusTimeChanged(float StartTime, float EndTime);
+	UFUNCTION(BlueprintImplementableEvent, Category = "Status Effect User Widget")
+	void OnPowerChanged(float Power);
+	UFUNCTION(BlueprintImplementableEvent, Category = "Status Effect User Widget")
+	void OnStackCountChanged(int32 StackCount);
+
+	void BindToStatusEffect();
+	void UnbindFromStatusEffect();
+
+	UFUNCTION()
+	void ReceiveStatusTimeUpdate(UStatusEffectBase* Status, float StartTime, float EndTime);
+	UFUNCTION()
+	void ReceivePowerUpdate(UStatusEffectBase* Status, float Power);
+	UFUNCTION()
+	void ReceiveStackCountUpdate(UStatusEffectBase* Status, uint8 StackCount);
+
+	//Pushes the status effect's start and end time into StatusTimeImage's material, converted into the time base UI materials use. The material is then responsible for animating progress.
+	void UpdateStatusTimeMaterial(float StartTime, float EndTime);
+
+protected:
+	//Optional image whose material animates status time progress on the GPU using the StatusTimeStartParameter and StatusTimeEndParameter scalar parameters.
+	UPROPERTY(BlueprintReadOnly, Category = "Status Effect User Widget", meta = (BindWidgetOptional))
+	UImage* StatusTimeImage = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Status Effect User Widget")
+	FName StatusTimeStartParameter = "StatusStartTime";
+	UPROPERTY(EditDefaultsOnly, Category = "Status Effect User Widget")
+	FName StatusTimeEndParameter = "StatusEndTime";
+
+	UPROPERTY(Transient)
+	UMaterialInstanceDynamic* StatusTimeMaterial = nullptr;
 	
 protected:
 	UPROPERTY(BlueprintReadOnly, VisibleInstanceOnly, meta = (ExposeOnSpawn = true))